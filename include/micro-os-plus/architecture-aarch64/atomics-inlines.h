@@ -0,0 +1,362 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_ATOMICS_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_ATOMICS_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/atomics.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the AArch64 atomic operations.
+
+#if defined(MICRO_OS_PLUS_USE_ATOMICS_LSE) && !defined(__ARM_FEATURE_ATOMICS)
+// Allow the LSE instructions even if the compiler does not target them.
+#define AARCH64_ATOMICS_LSE_PREAMBLE " .arch_extension lse \n"
+#else
+#define AARCH64_ATOMICS_LSE_PREAMBLE ""
+#endif
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  aarch64_architecture_atomic_compare_exchange_32 (volatile uint32_t* ptr,
+                                                   uint32_t expected,
+                                                   uint32_t desired)
+  {
+#if defined(MICRO_OS_PLUS_USE_ATOMICS_LSE)
+    uint32_t old = expected;
+
+    __asm__ volatile(
+
+        AARCH64_ATOMICS_LSE_PREAMBLE
+        " casal %w[old], %w[desired], %[mem] \n"
+
+        : [old] "+r"(old), [mem] "+Q"(*ptr) /* Outputs */
+        : [desired] "r"(desired) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+#else
+    uint32_t old;
+    uint32_t status;
+
+    __asm__ volatile(
+
+        "1: \n"
+        " ldaxr %w[old], %[mem] \n"
+        " cmp %w[old], %w[expected] \n"
+        " b.ne 2f \n"
+        " stlxr %w[status], %w[desired], %[mem] \n"
+        " cbnz %w[status], 1b \n"
+        "2: \n"
+
+        : [old] "=&r"(old), [status] "=&r"(status),
+          [mem] "+Q"(*ptr) /* Outputs */
+        : [expected] "r"(expected), [desired] "r"(desired) /* Inputs */
+        : "cc", "memory" /* Clobbers */
+    );
+#endif // defined(MICRO_OS_PLUS_USE_ATOMICS_LSE)
+
+    return old;
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  aarch64_architecture_atomic_fetch_add_32 (volatile uint32_t* ptr,
+                                            uint32_t value)
+  {
+    uint32_t old;
+
+#if defined(MICRO_OS_PLUS_USE_ATOMICS_LSE)
+    __asm__ volatile(
+
+        AARCH64_ATOMICS_LSE_PREAMBLE
+        " ldaddal %w[value], %w[old], %[mem] \n"
+
+        : [old] "=r"(old), [mem] "+Q"(*ptr) /* Outputs */
+        : [value] "r"(value) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+#else
+    uint32_t result;
+    uint32_t status;
+
+    __asm__ volatile(
+
+        "1: \n"
+        " ldaxr %w[old], %[mem] \n"
+        " add %w[result], %w[old], %w[value] \n"
+        " stlxr %w[status], %w[result], %[mem] \n"
+        " cbnz %w[status], 1b \n"
+
+        : [old] "=&r"(old), [result] "=&r"(result), [status] "=&r"(status),
+          [mem] "+Q"(*ptr) /* Outputs */
+        : [value] "r"(value) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+#endif // defined(MICRO_OS_PLUS_USE_ATOMICS_LSE)
+
+    return old;
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  aarch64_architecture_atomic_swap_32 (volatile uint32_t* ptr,
+                                       uint32_t value)
+  {
+    uint32_t old;
+
+#if defined(MICRO_OS_PLUS_USE_ATOMICS_LSE)
+    __asm__ volatile(
+
+        AARCH64_ATOMICS_LSE_PREAMBLE
+        " swpal %w[value], %w[old], %[mem] \n"
+
+        : [old] "=r"(old), [mem] "+Q"(*ptr) /* Outputs */
+        : [value] "r"(value) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+#else
+    uint32_t status;
+
+    __asm__ volatile(
+
+        "1: \n"
+        " ldaxr %w[old], %[mem] \n"
+        " stlxr %w[status], %w[value], %[mem] \n"
+        " cbnz %w[status], 1b \n"
+
+        : [old] "=&r"(old), [status] "=&r"(status),
+          [mem] "+Q"(*ptr) /* Outputs */
+        : [value] "r"(value) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+#endif // defined(MICRO_OS_PLUS_USE_ATOMICS_LSE)
+
+    return old;
+  }
+
+  static inline __attribute__ ((always_inline)) uint64_t
+  aarch64_architecture_atomic_compare_exchange_64 (volatile uint64_t* ptr,
+                                                   uint64_t expected,
+                                                   uint64_t desired)
+  {
+#if defined(MICRO_OS_PLUS_USE_ATOMICS_LSE)
+    uint64_t old = expected;
+
+    __asm__ volatile(
+
+        AARCH64_ATOMICS_LSE_PREAMBLE
+        " casal %x[old], %x[desired], %[mem] \n"
+
+        : [old] "+r"(old), [mem] "+Q"(*ptr) /* Outputs */
+        : [desired] "r"(desired) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+#else
+    uint64_t old;
+    uint32_t status;
+
+    __asm__ volatile(
+
+        "1: \n"
+        " ldaxr %x[old], %[mem] \n"
+        " cmp %x[old], %x[expected] \n"
+        " b.ne 2f \n"
+        " stlxr %w[status], %x[desired], %[mem] \n"
+        " cbnz %w[status], 1b \n"
+        "2: \n"
+
+        : [old] "=&r"(old), [status] "=&r"(status),
+          [mem] "+Q"(*ptr) /* Outputs */
+        : [expected] "r"(expected), [desired] "r"(desired) /* Inputs */
+        : "cc", "memory" /* Clobbers */
+    );
+#endif // defined(MICRO_OS_PLUS_USE_ATOMICS_LSE)
+
+    return old;
+  }
+
+  static inline __attribute__ ((always_inline)) uint64_t
+  aarch64_architecture_atomic_fetch_add_64 (volatile uint64_t* ptr,
+                                            uint64_t value)
+  {
+    uint64_t old;
+
+#if defined(MICRO_OS_PLUS_USE_ATOMICS_LSE)
+    __asm__ volatile(
+
+        AARCH64_ATOMICS_LSE_PREAMBLE
+        " ldaddal %x[value], %x[old], %[mem] \n"
+
+        : [old] "=r"(old), [mem] "+Q"(*ptr) /* Outputs */
+        : [value] "r"(value) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+#else
+    uint64_t result;
+    uint32_t status;
+
+    __asm__ volatile(
+
+        "1: \n"
+        " ldaxr %x[old], %[mem] \n"
+        " add %x[result], %x[old], %x[value] \n"
+        " stlxr %w[status], %x[result], %[mem] \n"
+        " cbnz %w[status], 1b \n"
+
+        : [old] "=&r"(old), [result] "=&r"(result), [status] "=&r"(status),
+          [mem] "+Q"(*ptr) /* Outputs */
+        : [value] "r"(value) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+#endif // defined(MICRO_OS_PLUS_USE_ATOMICS_LSE)
+
+    return old;
+  }
+
+  static inline __attribute__ ((always_inline)) uint64_t
+  aarch64_architecture_atomic_swap_64 (volatile uint64_t* ptr,
+                                       uint64_t value)
+  {
+    uint64_t old;
+
+#if defined(MICRO_OS_PLUS_USE_ATOMICS_LSE)
+    __asm__ volatile(
+
+        AARCH64_ATOMICS_LSE_PREAMBLE
+        " swpal %x[value], %x[old], %[mem] \n"
+
+        : [old] "=r"(old), [mem] "+Q"(*ptr) /* Outputs */
+        : [value] "r"(value) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+#else
+    uint32_t status;
+
+    __asm__ volatile(
+
+        "1: \n"
+        " ldaxr %x[old], %[mem] \n"
+        " stlxr %w[status], %x[value], %[mem] \n"
+        " cbnz %w[status], 1b \n"
+
+        : [old] "=&r"(old), [status] "=&r"(status),
+          [mem] "+Q"(*ptr) /* Outputs */
+        : [value] "r"(value) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+#endif // defined(MICRO_OS_PLUS_USE_ATOMICS_LSE)
+
+    return old;
+  }
+
+  static inline __attribute__ ((always_inline)) bool
+  aarch64_architecture_atomic_test_and_set (volatile uint32_t* ptr)
+  {
+    return aarch64_architecture_atomic_swap_32 (ptr, 1) != 0;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_atomic_clear (volatile uint32_t* ptr)
+  {
+    __asm__ volatile(
+
+        " stlr wzr, %[mem] \n"
+
+        : [mem] "=Q"(*ptr) /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::atomic
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) uint32_t
+  compare_exchange (volatile uint32_t* ptr, uint32_t expected, uint32_t desired)
+  {
+    return aarch64_architecture_atomic_compare_exchange_32 (ptr, expected,
+                                                            desired);
+  }
+
+  inline __attribute__ ((always_inline)) uint32_t
+  fetch_add (volatile uint32_t* ptr, uint32_t value)
+  {
+    return aarch64_architecture_atomic_fetch_add_32 (ptr, value);
+  }
+
+  inline __attribute__ ((always_inline)) uint32_t
+  swap (volatile uint32_t* ptr, uint32_t value)
+  {
+    return aarch64_architecture_atomic_swap_32 (ptr, value);
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  compare_exchange (volatile uint64_t* ptr, uint64_t expected, uint64_t desired)
+  {
+    return aarch64_architecture_atomic_compare_exchange_64 (ptr, expected,
+                                                            desired);
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  fetch_add (volatile uint64_t* ptr, uint64_t value)
+  {
+    return aarch64_architecture_atomic_fetch_add_64 (ptr, value);
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  swap (volatile uint64_t* ptr, uint64_t value)
+  {
+    return aarch64_architecture_atomic_swap_64 (ptr, value);
+  }
+
+  inline __attribute__ ((always_inline)) bool
+  test_and_set (volatile uint32_t* ptr)
+  {
+    return aarch64_architecture_atomic_test_and_set (ptr);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  clear (volatile uint32_t* ptr)
+  {
+    aarch64_architecture_atomic_clear (ptr);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::atomic
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_ATOMICS_INLINES_H_
+
+// ----------------------------------------------------------------------------
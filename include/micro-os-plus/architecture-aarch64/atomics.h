@@ -0,0 +1,165 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_ATOMICS_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_ATOMICS_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/defines.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Declarations of the AArch64 atomic operations.
+//
+// Two implementations are available, selected at compile time:
+// - the ARMv8.1 Large System Extension instructions (cas, ldadd, swp),
+//   if MICRO_OS_PLUS_USE_ATOMICS_LSE is defined, or by default
+//   when the compiler targets LSE (__ARM_FEATURE_ATOMICS);
+// - load-exclusive/store-exclusive loops (ldaxr/stlxr) otherwise,
+//   or if MICRO_OS_PLUS_USE_ATOMICS_LLSC is defined.
+//
+// All read-modify-write operations have acquire-release semantics.
+
+#if !defined(MICRO_OS_PLUS_USE_ATOMICS_LSE)                                   \
+    && !defined(MICRO_OS_PLUS_USE_ATOMICS_LLSC)
+#if defined(__ARM_FEATURE_ATOMICS)
+#define MICRO_OS_PLUS_USE_ATOMICS_LSE
+#else
+#define MICRO_OS_PLUS_USE_ATOMICS_LLSC
+#endif // defined(__ARM_FEATURE_ATOMICS)
+#endif
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+  // Atomic operations in C.
+
+  /**
+   * If `*ptr` equals `expected`, store `desired`.
+   * Return the previous value of `*ptr`.
+   */
+  static uint32_t
+  aarch64_architecture_atomic_compare_exchange_32 (volatile uint32_t* ptr,
+                                                   uint32_t expected,
+                                                   uint32_t desired);
+
+  static uint64_t
+  aarch64_architecture_atomic_compare_exchange_64 (volatile uint64_t* ptr,
+                                                   uint64_t expected,
+                                                   uint64_t desired);
+
+  /**
+   * Add `value` to `*ptr`. Return the previous value.
+   */
+  static uint32_t
+  aarch64_architecture_atomic_fetch_add_32 (volatile uint32_t* ptr,
+                                            uint32_t value);
+
+  static uint64_t
+  aarch64_architecture_atomic_fetch_add_64 (volatile uint64_t* ptr,
+                                            uint64_t value);
+
+  /**
+   * Store `value` into `*ptr`. Return the previous value.
+   */
+  static uint32_t
+  aarch64_architecture_atomic_swap_32 (volatile uint32_t* ptr,
+                                       uint32_t value);
+
+  static uint64_t
+  aarch64_architecture_atomic_swap_64 (volatile uint64_t* ptr,
+                                       uint64_t value);
+
+  /**
+   * Set `*ptr` to 1. Return true if it was already non-zero.
+   */
+  static bool
+  aarch64_architecture_atomic_test_and_set (volatile uint32_t* ptr);
+
+  /**
+   * Set `*ptr` to 0, with release semantics.
+   */
+  static void
+  aarch64_architecture_atomic_clear (volatile uint32_t* ptr);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::atomic
+{
+  // --------------------------------------------------------------------------
+  // Atomic operations in C++.
+
+  /**
+   * If `*ptr` equals `expected`, store `desired`; return the previous value.
+   */
+  uint32_t
+  compare_exchange (volatile uint32_t* ptr, uint32_t expected,
+                    uint32_t desired);
+
+  uint64_t
+  compare_exchange (volatile uint64_t* ptr, uint64_t expected,
+                    uint64_t desired);
+
+  /**
+   * Add `value` to `*ptr`; return the previous value.
+   */
+  uint32_t
+  fetch_add (volatile uint32_t* ptr, uint32_t value);
+
+  uint64_t
+  fetch_add (volatile uint64_t* ptr, uint64_t value);
+
+  /**
+   * Store `value` into `*ptr`; return the previous value.
+   */
+  uint32_t
+  swap (volatile uint32_t* ptr, uint32_t value);
+
+  uint64_t
+  swap (volatile uint64_t* ptr, uint64_t value);
+
+  /**
+   * Set `*ptr` to 1; return true if it was already set.
+   */
+  bool
+  test_and_set (volatile uint32_t* ptr);
+
+  /**
+   * Set `*ptr` to 0.
+   */
+  void
+  clear (volatile uint32_t* ptr);
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::atomic
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_ATOMICS_H_
+
+// ----------------------------------------------------------------------------
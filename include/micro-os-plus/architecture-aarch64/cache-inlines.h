@@ -0,0 +1,379 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_CACHE_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_CACHE_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/cache.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the AArch64 cache maintenance functions.
+
+// CTR_EL0 fields.
+#define AARCH64_CTR_IMINLINE_MASK (0xFU)
+#define AARCH64_CTR_DMINLINE_SHIFT (16)
+#define AARCH64_CTR_DMINLINE_MASK (0xFU)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) aarch64_architecture_register_t
+  aarch64_architecture_get_ctr (void)
+  {
+    aarch64_architecture_register_t result;
+
+    __asm__(
+
+        " mrs %[result], ctr_el0 "
+
+        : [result] "=r"(result) /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+
+    return result;
+  }
+
+  static inline __attribute__ ((always_inline)) size_t
+  aarch64_architecture_dcache_get_line_size (void)
+  {
+    // The field is log2 of the number of 4-byte words.
+    return (size_t)4 << ((aarch64_architecture_get_ctr ()
+                          >> AARCH64_CTR_DMINLINE_SHIFT)
+                         & AARCH64_CTR_DMINLINE_MASK);
+  }
+
+  static inline __attribute__ ((always_inline)) size_t
+  aarch64_architecture_icache_get_line_size (void)
+  {
+    return (size_t)4
+           << (aarch64_architecture_get_ctr () & AARCH64_CTR_IMINLINE_MASK);
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_dcache_clean (const volatile void* address,
+                                     size_t size)
+  {
+    size_t line = aarch64_architecture_dcache_get_line_size ();
+    uintptr_t end = (uintptr_t)address + size;
+
+    for (uintptr_t p = (uintptr_t)address & ~(line - 1); p < end; p += line)
+      {
+        __asm__ volatile(
+
+            " dc cvac, %[p] "
+
+            : /* Outputs */
+            : [p] "r"(p) /* Inputs */
+            : "memory" /* Clobbers */
+        );
+      }
+
+    __asm__ volatile(
+
+        " dsb sy "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_dcache_invalidate (const volatile void* address,
+                                          size_t size)
+  {
+    size_t line = aarch64_architecture_dcache_get_line_size ();
+    uintptr_t mask = line - 1;
+    uintptr_t p = (uintptr_t)address;
+    uintptr_t end = p + size;
+
+    // Lines shared with adjacent data are cleaned too, not just
+    // discarded, to preserve that data.
+    if (p & mask)
+      {
+        p &= ~mask;
+        __asm__ volatile(
+
+            " dc civac, %[p] "
+
+            : /* Outputs */
+            : [p] "r"(p) /* Inputs */
+            : "memory" /* Clobbers */
+        );
+        p += line;
+      }
+
+    if ((end & mask) && (end & ~mask) >= p)
+      {
+        end &= ~mask;
+        __asm__ volatile(
+
+            " dc civac, %[p] "
+
+            : /* Outputs */
+            : [p] "r"(end) /* Inputs */
+            : "memory" /* Clobbers */
+        );
+      }
+
+    for (; p < end; p += line)
+      {
+        __asm__ volatile(
+
+            " dc ivac, %[p] "
+
+            : /* Outputs */
+            : [p] "r"(p) /* Inputs */
+            : "memory" /* Clobbers */
+        );
+      }
+
+    __asm__ volatile(
+
+        " dsb sy "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_dcache_clean_invalidate (const volatile void* address,
+                                                size_t size)
+  {
+    size_t line = aarch64_architecture_dcache_get_line_size ();
+    uintptr_t end = (uintptr_t)address + size;
+
+    for (uintptr_t p = (uintptr_t)address & ~(line - 1); p < end; p += line)
+      {
+        __asm__ volatile(
+
+            " dc civac, %[p] "
+
+            : /* Outputs */
+            : [p] "r"(p) /* Inputs */
+            : "memory" /* Clobbers */
+        );
+      }
+
+    __asm__ volatile(
+
+        " dsb sy "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_icache_sync (const volatile void* address, size_t size)
+  {
+    uintptr_t end = (uintptr_t)address + size;
+
+    // Push the new instructions to the Point of Unification...
+    size_t line = aarch64_architecture_dcache_get_line_size ();
+    for (uintptr_t p = (uintptr_t)address & ~(line - 1); p < end; p += line)
+      {
+        __asm__ volatile(
+
+            " dc cvau, %[p] "
+
+            : /* Outputs */
+            : [p] "r"(p) /* Inputs */
+            : "memory" /* Clobbers */
+        );
+      }
+
+    __asm__ volatile(
+
+        " dsb ish "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+
+    // ... discard the stale instructions, on all cores ...
+    line = aarch64_architecture_icache_get_line_size ();
+    for (uintptr_t p = (uintptr_t)address & ~(line - 1); p < end; p += line)
+      {
+        __asm__ volatile(
+
+            " ic ivau, %[p] "
+
+            : /* Outputs */
+            : [p] "r"(p) /* Inputs */
+            : "memory" /* Clobbers */
+        );
+      }
+
+    // ... and refetch the instructions on this core.
+    __asm__ volatile(
+
+        " dsb ish \n"
+        " isb \n"
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::cache
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) size_t
+  dcache_line_size (void)
+  {
+    return aarch64_architecture_dcache_get_line_size ();
+  }
+
+  inline __attribute__ ((always_inline)) size_t
+  icache_line_size (void)
+  {
+    return aarch64_architecture_icache_get_line_size ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  clean (const volatile void* address, size_t size)
+  {
+    aarch64_architecture_dcache_clean (address, size);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  invalidate (const volatile void* address, size_t size)
+  {
+    aarch64_architecture_dcache_invalidate (address, size);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  clean_invalidate (const volatile void* address, size_t size)
+  {
+    aarch64_architecture_dcache_clean_invalidate (address, size);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  sync_icache (const volatile void* address, size_t size)
+  {
+    aarch64_architecture_icache_sync (address, size);
+  }
+
+  // --------------------------------------------------------------------------
+
+  template <typename T, size_t N>
+  inline void
+  dma_buffer<T, N>::for_device (dma_direction direction)
+  {
+    switch (direction)
+      {
+      case dma_direction::to_device:
+        // The device reads what the CPU wrote.
+        clean (buffer_, sizeof (buffer_));
+        break;
+
+      case dma_direction::from_device:
+        // No dirty line may be evicted over the incoming data.
+        invalidate (buffer_, sizeof (buffer_));
+        break;
+
+      case dma_direction::bidirectional:
+        clean_invalidate (buffer_, sizeof (buffer_));
+        break;
+      }
+  }
+
+  template <typename T, size_t N>
+  inline void
+  dma_buffer<T, N>::for_cpu (dma_direction direction)
+  {
+    if (direction != dma_direction::to_device)
+      {
+        // Drop the lines speculatively loaded during the transfer.
+        invalidate (buffer_, sizeof (buffer_));
+      }
+  }
+
+  template <typename T, size_t N>
+  inline __attribute__ ((always_inline)) T*
+  dma_buffer<T, N>::data (void)
+  {
+    return buffer_;
+  }
+
+  template <typename T, size_t N>
+  inline __attribute__ ((always_inline)) const T*
+  dma_buffer<T, N>::data (void) const
+  {
+    return buffer_;
+  }
+
+  template <typename T, size_t N>
+  constexpr size_t
+  dma_buffer<T, N>::size (void)
+  {
+    return N;
+  }
+
+  template <typename T, size_t N>
+  constexpr size_t
+  dma_buffer<T, N>::size_bytes (void)
+  {
+    return sizeof (T) * N;
+  }
+
+  template <typename T, size_t N>
+  inline __attribute__ ((always_inline)) T&
+  dma_buffer<T, N>::operator[] (size_t index)
+  {
+    return buffer_[index];
+  }
+
+  template <typename T, size_t N>
+  inline __attribute__ ((always_inline)) const T&
+  dma_buffer<T, N>::operator[] (size_t index) const
+  {
+    return buffer_[index];
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::cache
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_CACHE_INLINES_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,248 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_CACHE_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_CACHE_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/defines.h>
+#include <micro-os-plus/architecture-aarch64/types.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Declarations of the AArch64 cache maintenance functions.
+//
+// The range functions operate by virtual address, to the Point of
+// Coherency, and complete with a `dsb sy`, so the results are visible
+// to bus masters (like DMA controllers) when they return.
+// The cache line size is taken from CTR_EL0.
+
+// Alignment used for the DMA buffers; it must not be smaller than
+// the Cache Writeback Granule (CTR_EL0.CWG) of the device.
+#if !defined(MICRO_OS_PLUS_INTEGER_CACHE_LINE_SIZE)
+#define MICRO_OS_PLUS_INTEGER_CACHE_LINE_SIZE (64)
+#endif
+
+// Placement in the linker script groups, see linker-scripts/README.md.
+// Functions marked `__attribute__ ((hot))` or `((cold))` are already
+// placed in `.text.hot`/`.text.unlikely` by the compiler.
+
+// Code and data for the on-chip SRAM/TCM, if the device has one.
+#define MICRO_OS_PLUS_ATTRIBUTE_FAST_TEXT                                     \
+  __attribute__ ((section (".fast_text"), noinline))
+#define MICRO_OS_PLUS_ATTRIBUTE_FAST_DATA                                     \
+  __attribute__ ((section (".fast_data")))
+
+// Initialised data seldom written, shared by all cores.
+#define MICRO_OS_PLUS_ATTRIBUTE_READ_MOSTLY                                   \
+  __attribute__ ((section (".data_read_mostly")))
+
+// Initialised data written often, on its own cache line(s); the size
+// should also be a multiple of the line size.
+#define MICRO_OS_PLUS_ATTRIBUTE_WRITE_HOT                                     \
+  __attribute__ ((section (".data_write_hot"),                               \
+                  aligned (MICRO_OS_PLUS_INTEGER_CACHE_LINE_SIZE)))
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+  // Cache maintenance in C.
+
+  /**
+   * Cache Type Register getter (CTR_EL0).
+   */
+  static aarch64_architecture_register_t
+  aarch64_architecture_get_ctr (void);
+
+  /**
+   * Smallest data cache line size, in bytes (CTR_EL0.DminLine).
+   */
+  static size_t
+  aarch64_architecture_dcache_get_line_size (void);
+
+  /**
+   * Smallest instruction cache line size, in bytes (CTR_EL0.IminLine).
+   */
+  static size_t
+  aarch64_architecture_icache_get_line_size (void);
+
+  /**
+   * Write the dirty lines to memory (`dc cvac`); to be used before
+   * a bus master reads the memory.
+   */
+  static void
+  aarch64_architecture_dcache_clean (const volatile void* address,
+                                     size_t size);
+
+  /**
+   * Discard the cached lines (`dc ivac`); to be used after a bus master
+   * wrote the memory. Partial lines at the ends of the range are also
+   * cleaned, to preserve the adjacent data.
+   */
+  static void
+  aarch64_architecture_dcache_invalidate (const volatile void* address,
+                                          size_t size);
+
+  /**
+   * Write the dirty lines to memory and discard them (`dc civac`).
+   */
+  static void
+  aarch64_architecture_dcache_clean_invalidate (const volatile void* address,
+                                                size_t size);
+
+  /**
+   * Make the instructions written as data in the range visible to
+   * the instruction fetches (`dc cvau`, `ic ivau`, `isb`); to be used
+   * after loading or patching code.
+   */
+  static void
+  aarch64_architecture_icache_sync (const volatile void* address,
+                                    size_t size);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::cache
+{
+  // --------------------------------------------------------------------------
+  // Cache maintenance in C++.
+
+  /**
+   * Smallest data cache line size, in bytes.
+   */
+  size_t
+  dcache_line_size (void);
+
+  /**
+   * Smallest instruction cache line size, in bytes.
+   */
+  size_t
+  icache_line_size (void);
+
+  /**
+   * Write the dirty lines in the range to memory.
+   */
+  void
+  clean (const volatile void* address, size_t size);
+
+  /**
+   * Discard the cached lines in the range.
+   */
+  void
+  invalidate (const volatile void* address, size_t size);
+
+  /**
+   * Write the dirty lines in the range to memory and discard them.
+   */
+  void
+  clean_invalidate (const volatile void* address, size_t size);
+
+  /**
+   * Make the code written in the range visible to instruction fetches.
+   */
+  void
+  sync_icache (const volatile void* address, size_t size);
+
+  /**
+   * Direction of the DMA transfers.
+   */
+  enum class dma_direction
+  {
+    to_device,
+    from_device,
+    bidirectional
+  };
+
+  /**
+   * Cacheable buffer used directly by DMA transfers.
+   *
+   * The buffer is aligned and padded to the cache line size, so no
+   * other object shares its lines. Ownership alternates between the
+   * CPU and the device; call `for_device()` before starting a transfer
+   * and `for_cpu()` after it completes, with the same direction.
+   */
+  template <typename T, size_t N = 1>
+  class alignas (MICRO_OS_PLUS_INTEGER_CACHE_LINE_SIZE) dma_buffer
+  {
+  public:
+    using value_type = T;
+
+    constexpr dma_buffer () = default;
+
+    dma_buffer (const dma_buffer&) = delete;
+    dma_buffer (dma_buffer&&) = delete;
+    dma_buffer&
+    operator= (const dma_buffer&)
+        = delete;
+    dma_buffer&
+    operator= (dma_buffer&&)
+        = delete;
+
+    ~dma_buffer () = default;
+
+    /**
+     * Pass ownership to the device, before starting a transfer.
+     */
+    void
+    for_device (dma_direction direction);
+
+    /**
+     * Take back ownership, after the transfer completed.
+     */
+    void
+    for_cpu (dma_direction direction);
+
+    T*
+    data (void);
+
+    const T*
+    data (void) const;
+
+    static constexpr size_t
+    size (void);
+
+    static constexpr size_t
+    size_bytes (void);
+
+    T&
+    operator[] (size_t index);
+
+    const T&
+    operator[] (size_t index) const;
+
+  protected:
+    T buffer_[N]{};
+  };
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::cache
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_CACHE_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,133 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_CLOCK_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_CLOCK_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/clock.h>
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the AArch64 monotonic clock.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) uint64_t
+  aarch64_architecture_clock_scale (uint64_t value, uint64_t integer,
+                                    uint64_t fraction)
+  {
+    // `umulh` for the fractional part.
+    __extension__ typedef unsigned __int128 uint128_t;
+
+    return value * integer
+           + (uint64_t)(((uint128_t)value * fraction) >> 64);
+  }
+
+  static inline __attribute__ ((always_inline)) uint64_t
+  aarch64_architecture_clock_get_ticks (void)
+  {
+    return aarch64_architecture_generic_timer_get_counter ();
+  }
+
+  static inline __attribute__ ((always_inline)) uint64_t
+  aarch64_architecture_clock_ticks_to_ns (uint64_t ticks)
+  {
+    return aarch64_architecture_clock_scale (
+        ticks, aarch64_architecture_clock.ns_per_tick,
+        aarch64_architecture_clock.ns_per_tick_fraction);
+  }
+
+  static inline __attribute__ ((always_inline)) uint64_t
+  aarch64_architecture_clock_ns_to_ticks (uint64_t ns)
+  {
+    return aarch64_architecture_clock_scale (
+        ns, aarch64_architecture_clock.ticks_per_ns,
+        aarch64_architecture_clock.ticks_per_ns_fraction);
+  }
+
+  static inline __attribute__ ((always_inline)) uint64_t
+  aarch64_architecture_clock_get_ns (void)
+  {
+    return aarch64_architecture_clock_ticks_to_ns (
+        aarch64_architecture_clock_get_ticks ());
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::clock
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) uint64_t
+  ticks (void)
+  {
+    return aarch64_architecture_clock_get_ticks ();
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  ns (void)
+  {
+    return aarch64_architecture_clock_get_ns ();
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  ticks_to_ns (uint64_t ticks)
+  {
+    return aarch64_architecture_clock_ticks_to_ns (ticks);
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  ns_to_ticks (uint64_t ns)
+  {
+    return aarch64_architecture_clock_ns_to_ticks (ns);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::clock
+
+namespace micro_os_plus::architecture
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) monotonic_clock::time_point
+  monotonic_clock::now (void) noexcept
+  {
+    return time_point{ duration{
+        static_cast<rep> (aarch64_architecture_clock_get_ns ()) } };
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::architecture
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_CLOCK_INLINES_H_
+
+// ----------------------------------------------------------------------------
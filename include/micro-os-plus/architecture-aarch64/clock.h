@@ -0,0 +1,176 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_CLOCK_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_CLOCK_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/defines.h>
+#include <micro-os-plus/architecture-aarch64/types.h>
+#include <micro-os-plus/architecture-aarch64/generic-timer.h>
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+#include <chrono>
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+// Declarations of the AArch64 monotonic clock.
+//
+// The time is the generic timer counter (CNTVCT_EL0, or CNTPCT_EL0),
+// read in order with the previous instructions, converted to ns. The
+// conversion uses constants computed once from CNTFRQ_EL0, during the
+// `.preinit_array_sysinit` stage: the integer part of the ratio and
+// its fractional part scaled by 2^64, so it takes one `mul`, one
+// `umulh` and one `add`, without a division. The result is the exact
+// value rounded down, or 1 ns less.
+//
+// The counter is 0 at reset and never wraps in practice; the time
+// in ns overflows after 584 years.
+//
+// The definitions are compiled only with MICRO_OS_PLUS_INCLUDE_CLOCK.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  /**
+   * The conversion constants, `value * integer + (value * fraction)
+   * >> 64`, in both directions.
+   */
+  typedef struct aarch64_architecture_clock_s
+  {
+    uint64_t ns_per_tick;
+    uint64_t ns_per_tick_fraction;
+    uint64_t ticks_per_ns;
+    uint64_t ticks_per_ns_fraction;
+    // The counter frequency, in Hz.
+    uint32_t frequency;
+  } aarch64_architecture_clock_t;
+
+  extern aarch64_architecture_clock_t aarch64_architecture_clock;
+
+  // --------------------------------------------------------------------------
+  // Monotonic clock in C.
+
+  /**
+   * Compute the constants for a counter of `frequency` Hz.
+   */
+  void
+  aarch64_architecture_clock_calibrate (aarch64_architecture_clock_t* clock,
+                                        uint32_t frequency);
+
+  /**
+   * Compute the constants from CNTFRQ_EL0. Called automatically at
+   * startup; to be called again only if the frequency is changed.
+   */
+  void
+  aarch64_architecture_clock_initialize (void);
+
+  /**
+   * `value * integer + (value * fraction) >> 64`.
+   */
+  static uint64_t
+  aarch64_architecture_clock_scale (uint64_t value, uint64_t integer,
+                                    uint64_t fraction);
+
+  /**
+   * The counter, ordered after the previous instructions.
+   */
+  static uint64_t
+  aarch64_architecture_clock_get_ticks (void);
+
+  /**
+   * The time since reset, in ns.
+   */
+  static uint64_t
+  aarch64_architecture_clock_get_ns (void);
+
+  static uint64_t
+  aarch64_architecture_clock_ticks_to_ns (uint64_t ticks);
+
+  static uint64_t
+  aarch64_architecture_clock_ns_to_ticks (uint64_t ns);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::clock
+{
+  // --------------------------------------------------------------------------
+  // Monotonic clock in C++.
+
+  /**
+   * The counter, ordered.
+   */
+  uint64_t
+  ticks (void);
+
+  /**
+   * The time since reset, in ns.
+   */
+  uint64_t
+  ns (void);
+
+  uint64_t
+  ticks_to_ns (uint64_t ticks);
+
+  uint64_t
+  ns_to_ticks (uint64_t ns);
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::clock
+
+namespace micro_os_plus::architecture
+{
+  // --------------------------------------------------------------------------
+  // Portable monotonic clock in C++.
+
+  /**
+   * A `std::chrono` clock, with the time since reset, in ns.
+   */
+  class monotonic_clock
+  {
+  public:
+    using rep = int64_t;
+    using period = std::nano;
+    using duration = std::chrono::duration<rep, period>;
+    using time_point = std::chrono::time_point<monotonic_clock>;
+
+    static constexpr bool is_steady = true;
+
+    static time_point
+    now (void) noexcept;
+  };
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::architecture
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_CLOCK_H_
+
+// ----------------------------------------------------------------------------
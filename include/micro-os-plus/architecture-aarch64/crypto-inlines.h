@@ -0,0 +1,91 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_CRYPTO_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_CRYPTO_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/crypto.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the AArch64 checksum and cryptography
+// kernels.
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::crypto
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) uint32_t
+  features (void)
+  {
+    return aarch64_architecture_crypto_get_features ();
+  }
+
+  inline __attribute__ ((always_inline)) uint32_t
+  crc32 (const void* data, size_t size, uint32_t crc)
+  {
+    return aarch64_architecture_crc32 (crc, data, size);
+  }
+
+  inline __attribute__ ((always_inline)) uint32_t
+  crc32c (const void* data, size_t size, uint32_t crc)
+  {
+    return aarch64_architecture_crc32c (crc, data, size);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  sha256 (const void* data, size_t size,
+          uint8_t digest[AARCH64_SHA256_DIGEST_SIZE])
+  {
+    aarch64_architecture_sha256 (data, size, digest);
+  }
+
+  inline __attribute__ ((always_inline)) bool
+  aes_gcm::set_key (const void* bytes, size_t size)
+  {
+    return aarch64_architecture_aes_gcm_set_key (&gcm_, bytes, size) == 0;
+  }
+
+  inline __attribute__ ((always_inline)) void
+  aes_gcm::encrypt (const void* iv, const void* aad, size_t aad_size,
+                    const void* in, void* out, size_t size, void* tag) const
+  {
+    aarch64_architecture_aes_gcm_encrypt (&gcm_, iv, aad, aad_size, in, out,
+                                          size, tag);
+  }
+
+  inline __attribute__ ((always_inline)) bool
+  aes_gcm::decrypt (const void* iv, const void* aad, size_t aad_size,
+                    const void* in, void* out, size_t size,
+                    const void* tag) const
+  {
+    return aarch64_architecture_aes_gcm_decrypt (&gcm_, iv, aad, aad_size,
+                                                 in, out, size, tag)
+           == 0;
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::crypto
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_CRYPTO_INLINES_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,281 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_CRYPTO_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_CRYPTO_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/defines.h>
+#include <micro-os-plus/architecture-aarch64/types.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Declarations of the AArch64 checksum and cryptography kernels.
+//
+// CRC-32 (IEEE 802.3, as zlib) and CRC-32C (Castagnoli, as iSCSI),
+// AES-128/192/256 with GCM, and SHA-256. Each function checks once the
+// optional instructions implemented by the core (ID_AA64ISAR0_EL1) and
+// uses the CRC32, AES, PMULL and SHA256 instructions if present,
+// or portable C++ code otherwise, with the same results.
+//
+// The CRC functions process three interleaved streams, so the three
+// CRC units of the typical cores are kept busy; the partial results
+// are combined with PMULL.
+//
+// The kernels use the SIMD registers, the FP/SIMD access must be
+// enabled in CPACR_EL1.
+
+// The instructions implemented, as returned by
+// aarch64_architecture_crypto_get_features().
+#define AARCH64_CRYPTO_FEATURE_CRC32 (1u << 0)
+#define AARCH64_CRYPTO_FEATURE_AES (1u << 1)
+#define AARCH64_CRYPTO_FEATURE_PMULL (1u << 2)
+#define AARCH64_CRYPTO_FEATURE_SHA256 (1u << 3)
+
+#define AARCH64_AES_BLOCK_SIZE (16)
+#define AARCH64_AES_GCM_IV_SIZE (12)
+#define AARCH64_AES_GCM_TAG_SIZE (16)
+#define AARCH64_SHA256_BLOCK_SIZE (64)
+#define AARCH64_SHA256_DIGEST_SIZE (32)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  /**
+   * An expanded AES encryption key; the round keys are stored
+   * in the FIPS-197 byte order.
+   */
+  typedef struct aarch64_architecture_aes_key_s
+  {
+    uint8_t round_keys[15][AARCH64_AES_BLOCK_SIZE];
+    uint32_t rounds;
+  } aarch64_architecture_aes_key_t;
+
+  /**
+   * An AES-GCM key, with the GHASH key H.
+   */
+  typedef struct aarch64_architecture_aes_gcm_s
+  {
+    aarch64_architecture_aes_key_t key;
+    uint8_t h[AARCH64_AES_BLOCK_SIZE];
+  } aarch64_architecture_aes_gcm_t;
+
+  // --------------------------------------------------------------------------
+  // Checksums and cryptography in C.
+
+  /**
+   * The optional instructions implemented by the core and selected,
+   * as a mask of `AARCH64_CRYPTO_FEATURE_*` bits.
+   */
+  uint32_t
+  aarch64_architecture_crypto_get_features (void);
+
+  /**
+   * Restrict the functions to the instructions in `features`, for
+   * tests and benchmarks. Return the previous selection.
+   */
+  uint32_t
+  aarch64_architecture_crypto_select_features (uint32_t features);
+
+  /**
+   * Update a CRC-32 with `size` bytes; start with 0. The same as
+   * the zlib `crc32()`.
+   */
+  uint32_t
+  aarch64_architecture_crc32 (uint32_t crc, const void* data, size_t size);
+
+  /**
+   * Update a CRC-32C with `size` bytes; start with 0.
+   */
+  uint32_t
+  aarch64_architecture_crc32c (uint32_t crc, const void* data, size_t size);
+
+  /**
+   * Expand a 16, 24 or 32 bytes AES key. Return 0, or -1 if the size
+   * is not valid.
+   */
+  int
+  aarch64_architecture_aes_set_key (aarch64_architecture_aes_key_t* key,
+                                    const void* bytes, size_t size);
+
+  /**
+   * Encrypt one 16 bytes block; `in` and `out` may be the same.
+   */
+  void
+  aarch64_architecture_aes_encrypt_block (
+      const aarch64_architecture_aes_key_t* key, const void* in, void* out);
+
+  /**
+   * Expand the AES key and compute the GHASH key. Return 0, or -1
+   * if the size is not valid.
+   */
+  int
+  aarch64_architecture_aes_gcm_set_key (aarch64_architecture_aes_gcm_t* gcm,
+                                        const void* bytes, size_t size);
+
+  /**
+   * Encrypt `size` bytes and authenticate them together with
+   * the additional data, with a 12 bytes IV, which must never be
+   * reused with the same key. Write a 16 bytes tag.
+   */
+  void
+  aarch64_architecture_aes_gcm_encrypt (
+      const aarch64_architecture_aes_gcm_t* gcm, const void* iv,
+      const void* aad, size_t aad_size, const void* in, void* out,
+      size_t size, void* tag);
+
+  /**
+   * Decrypt and check the tag. Return 0, or -1 if the tag does not
+   * match; in this case the output must be discarded.
+   */
+  int
+  aarch64_architecture_aes_gcm_decrypt (
+      const aarch64_architecture_aes_gcm_t* gcm, const void* iv,
+      const void* aad, size_t aad_size, const void* in, void* out,
+      size_t size, const void* tag);
+
+  /**
+   * Process 64 bytes blocks, updating the eight state words.
+   */
+  void
+  aarch64_architecture_sha256_blocks (uint32_t state[8], const void* data,
+                                      size_t blocks);
+
+  /**
+   * Compute the SHA-256 digest of `size` bytes.
+   */
+  void
+  aarch64_architecture_sha256 (const void* data, size_t size,
+                               uint8_t digest[AARCH64_SHA256_DIGEST_SIZE]);
+
+  // --------------------------------------------------------------------------
+  // The kernels with the optional instructions, in assembly; to be
+  // called only if the features are present.
+
+  uint32_t
+  aarch64_architecture_crc32_ce (uint32_t crc, const void* data, size_t size,
+                                 uint32_t features);
+
+  uint32_t
+  aarch64_architecture_crc32c_ce (uint32_t crc, const void* data,
+                                  size_t size, uint32_t features);
+
+  void
+  aarch64_architecture_aes_encrypt_block_ce (
+      const aarch64_architecture_aes_key_t* key, const void* in, void* out);
+
+  /**
+   * CTR mode, with the 32-bit big endian counter in the last 4 bytes
+   * of the counter block, which is updated.
+   */
+  void
+  aarch64_architecture_aes_ctr_ce (const aarch64_architecture_aes_key_t* key,
+                                   uint8_t counter[AARCH64_AES_BLOCK_SIZE],
+                                   const void* in, void* out, size_t blocks);
+
+  /**
+   * Update the GHASH state with 16 bytes blocks.
+   */
+  void
+  aarch64_architecture_ghash_ce (uint8_t state[AARCH64_AES_BLOCK_SIZE],
+                                 const uint8_t h[AARCH64_AES_BLOCK_SIZE],
+                                 const void* data, size_t blocks);
+
+  void
+  aarch64_architecture_sha256_blocks_ce (uint32_t state[8], const void* data,
+                                         size_t blocks);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::crypto
+{
+  // --------------------------------------------------------------------------
+  // Checksums and cryptography in C++.
+
+  /**
+   * The `AARCH64_CRYPTO_FEATURE_*` mask.
+   */
+  uint32_t
+  features (void);
+
+  /**
+   * CRC-32 (IEEE 802.3), continued from `crc`.
+   */
+  uint32_t
+  crc32 (const void* data, size_t size, uint32_t crc = 0);
+
+  /**
+   * CRC-32C (Castagnoli), continued from `crc`.
+   */
+  uint32_t
+  crc32c (const void* data, size_t size, uint32_t crc = 0);
+
+  /**
+   * SHA-256 digest.
+   */
+  void
+  sha256 (const void* data, size_t size,
+          uint8_t digest[AARCH64_SHA256_DIGEST_SIZE]);
+
+  /**
+   * An AES-GCM key.
+   */
+  class aes_gcm
+  {
+  public:
+    aes_gcm () = default;
+
+    /**
+     * Set a 16, 24 or 32 bytes key.
+     */
+    bool
+    set_key (const void* bytes, size_t size);
+
+    void
+    encrypt (const void* iv, const void* aad, size_t aad_size,
+             const void* in, void* out, size_t size, void* tag) const;
+
+    /**
+     * False if the tag does not match.
+     */
+    bool
+    decrypt (const void* iv, const void* aad, size_t aad_size,
+             const void* in, void* out, size_t size,
+             const void* tag) const;
+
+  protected:
+    aarch64_architecture_aes_gcm_t gcm_{};
+  };
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::crypto
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_CRYPTO_H_
+
+// ----------------------------------------------------------------------------
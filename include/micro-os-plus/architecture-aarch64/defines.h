@@ -15,8 +15,13 @@
 
 // ----------------------------------------------------------------------------
 
+// Opt-in, from the application configuration; see stacks.h.
 // #define MICRO_OS_PLUS_HAS_INTERRUPTS_STACK
+
+// The stack fill pattern, for the high-water measurements.
+#if !defined(MICRO_OS_PLUS_INTEGER_STARTUP_STACK_FILL_MAGIC)
 #define MICRO_OS_PLUS_INTEGER_STARTUP_STACK_FILL_MAGIC (0xEFBEADDE)
+#endif // !defined(MICRO_OS_PLUS_INTEGER_STARTUP_STACK_FILL_MAGIC)
 
 // ----------------------------------------------------------------------------
 
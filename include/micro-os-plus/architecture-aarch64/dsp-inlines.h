@@ -0,0 +1,84 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_DSP_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_DSP_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/dsp.h>
+
+// ----------------------------------------------------------------------------
+// Inline C++ wrappers for the AArch64 signal processing kernels.
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::dsp
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) uint32_t
+  features (void)
+  {
+    return aarch64_architecture_dsp_get_features ();
+  }
+
+  inline __attribute__ ((always_inline)) size_t
+  vector_length (void)
+  {
+    return aarch64_architecture_dsp_get_vector_length ();
+  }
+
+  inline __attribute__ ((always_inline)) float
+  dot (const float* a, const float* b, size_t count)
+  {
+    return aarch64_architecture_dsp_dot_f32 (a, b, count);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  fir (const float* coefficients, size_t taps, const float* in, float* out,
+       size_t count)
+  {
+    aarch64_architecture_dsp_fir_f32 (coefficients, taps, in, out, count);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  gemv (const int8_t* matrix, const int8_t* x, int32_t* y, size_t rows,
+        size_t columns)
+  {
+    aarch64_architecture_dsp_gemv_s8 (matrix, x, y, rows, columns);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  gemv (const float16_t* matrix, const float16_t* x, float* y, size_t rows,
+        size_t columns)
+  {
+    aarch64_architecture_dsp_gemv_f16 (matrix, x, y, rows, columns);
+  }
+
+  inline __attribute__ ((always_inline)) bool
+  min_max (const float* data, size_t count, float& min, float& max)
+  {
+    return aarch64_architecture_dsp_min_max_f32 (data, count, &min, &max)
+           == 0;
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::dsp
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_DSP_INLINES_H_
+
+// ----------------------------------------------------------------------------
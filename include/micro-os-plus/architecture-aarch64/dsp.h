@@ -0,0 +1,273 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_DSP_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_DSP_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/defines.h>
+#include <micro-os-plus/architecture-aarch64/types.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Declarations of the AArch64 signal processing kernels.
+//
+// Dot product, FIR filter, int8 and fp16 matrix-vector products
+// and min/max reductions. Each function checks once the extensions
+// implemented by the core (ID_AA64PFR0_EL1) and uses the SVE code,
+// vector length agnostic, or the ASIMD (NEON) code, or portable
+// C++ code. The float results may differ in the last bits, since
+// the sums are done in a different order.
+//
+// At startup, the FP/SIMD and SVE access is enabled in CPACR_EL1
+// and the largest vector length is selected in ZCR_EL1, on all
+// cores. The SIMD/FP context saved on interrupts, when
+// MICRO_OS_PLUS_USE_INTERRUPTS_FP_CONTEXT is defined, does not
+// include the SVE state, and restoring the Q registers clears the
+// upper part of the Z registers; in this configuration the SVE
+// kernels run with the IRQs masked, so long inputs should be split
+// to keep the interrupt latency low.
+
+// The extensions used, as returned by
+// aarch64_architecture_dsp_get_features().
+#define AARCH64_DSP_FEATURE_ASIMD (1u << 0)
+#define AARCH64_DSP_FEATURE_SVE (1u << 1)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  /**
+   * IEEE 754 half precision.
+   */
+  typedef __fp16 aarch64_architecture_float16_t;
+
+  // --------------------------------------------------------------------------
+  // Signal processing in C.
+
+  /**
+   * The extensions implemented by the core and selected, as a mask
+   * of `AARCH64_DSP_FEATURE_*` bits.
+   */
+  uint32_t
+  aarch64_architecture_dsp_get_features (void);
+
+  /**
+   * Restrict the kernels to the extensions in `features`, for
+   * tests and benchmarks. Return the previous selection.
+   */
+  uint32_t
+  aarch64_architecture_dsp_select_features (uint32_t features);
+
+  /**
+   * The vector length in bytes, 16 without SVE.
+   */
+  size_t
+  aarch64_architecture_dsp_get_vector_length (void);
+
+  /**
+   * Request a SVE vector length of `bytes` (a multiple of 16, up to
+   * 256) on the current core. Return the length set, which may be
+   * lower if not implemented, or 16 without SVE.
+   */
+  size_t
+  aarch64_architecture_dsp_set_vector_length (size_t bytes);
+
+  /**
+   * Enable FP/SIMD and SVE on the current core, with the largest
+   * vector length. Called automatically at startup.
+   */
+  void
+  aarch64_architecture_dsp_initialize (void);
+
+  /**
+   * Sum of `a[i] * b[i]`.
+   */
+  float
+  aarch64_architecture_dsp_dot_f32 (const float* a, const float* b,
+                                    size_t count);
+
+  /**
+   * `out[i]` is the sum of `coefficients[k] * in[i + k]`, for
+   * k < `taps`; `in` has `count + taps - 1` samples, the history
+   * followed by the new ones, and the coefficients are in reverse
+   * order.
+   */
+  void
+  aarch64_architecture_dsp_fir_f32 (const float* coefficients, size_t taps,
+                                    const float* in, float* out,
+                                    size_t count);
+
+  /**
+   * `y[r]` is the sum of `matrix[r * columns + c] * x[c]`.
+   */
+  void
+  aarch64_architecture_dsp_gemv_s8 (const int8_t* matrix, const int8_t* x,
+                                    int32_t* y, size_t rows,
+                                    size_t columns);
+
+  /**
+   * The same, with the products summed in single precision.
+   */
+  void
+  aarch64_architecture_dsp_gemv_f16 (
+      const aarch64_architecture_float16_t* matrix,
+      const aarch64_architecture_float16_t* x, float* y, size_t rows,
+      size_t columns);
+
+  /**
+   * The minimum and maximum values, ignoring the NaNs. Return 0,
+   * or -1 if `count` is 0.
+   */
+  int
+  aarch64_architecture_dsp_min_max_f32 (const float* data, size_t count,
+                                        float* min, float* max);
+
+  // --------------------------------------------------------------------------
+  // The kernels in assembly; to be called only if the extension
+  // is present.
+
+  size_t
+  aarch64_architecture_dsp_get_vector_length_sve (void);
+
+  /**
+   * Write ZCR_EL1.LEN, return the vector length in bytes.
+   */
+  size_t
+  aarch64_architecture_dsp_set_vector_length_sve (uint32_t len);
+
+  float
+  aarch64_architecture_dsp_dot_f32_sve (const float* a, const float* b,
+                                        size_t count);
+
+  float
+  aarch64_architecture_dsp_dot_f32_asimd (const float* a, const float* b,
+                                          size_t count);
+
+  void
+  aarch64_architecture_dsp_fir_f32_sve (const float* coefficients,
+                                        size_t taps, const float* in,
+                                        float* out, size_t count);
+
+  void
+  aarch64_architecture_dsp_fir_f32_asimd (const float* coefficients,
+                                          size_t taps, const float* in,
+                                          float* out, size_t count);
+
+  void
+  aarch64_architecture_dsp_gemv_s8_sve (const int8_t* matrix,
+                                        const int8_t* x, int32_t* y,
+                                        size_t rows, size_t columns);
+
+  void
+  aarch64_architecture_dsp_gemv_s8_asimd (const int8_t* matrix,
+                                          const int8_t* x, int32_t* y,
+                                          size_t rows, size_t columns);
+
+  void
+  aarch64_architecture_dsp_gemv_f16_sve (
+      const aarch64_architecture_float16_t* matrix,
+      const aarch64_architecture_float16_t* x, float* y, size_t rows,
+      size_t columns);
+
+  void
+  aarch64_architecture_dsp_gemv_f16_asimd (
+      const aarch64_architecture_float16_t* matrix,
+      const aarch64_architecture_float16_t* x, float* y, size_t rows,
+      size_t columns);
+
+  /**
+   * `count` must not be 0.
+   */
+  void
+  aarch64_architecture_dsp_min_max_f32_sve (const float* data,
+                                            size_t count, float* min,
+                                            float* max);
+
+  void
+  aarch64_architecture_dsp_min_max_f32_asimd (const float* data,
+                                              size_t count, float* min,
+                                              float* max);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::dsp
+{
+  // --------------------------------------------------------------------------
+  // Signal processing in C++.
+
+  using float16_t = aarch64_architecture_float16_t;
+
+  /**
+   * The `AARCH64_DSP_FEATURE_*` mask.
+   */
+  uint32_t
+  features (void);
+
+  /**
+   * The vector length in bytes.
+   */
+  size_t
+  vector_length (void);
+
+  /**
+   * Sum of `a[i] * b[i]`.
+   */
+  float
+  dot (const float* a, const float* b, size_t count);
+
+  /**
+   * FIR filter; `in` has `count + taps - 1` samples.
+   */
+  void
+  fir (const float* coefficients, size_t taps, const float* in, float* out,
+       size_t count);
+
+  /**
+   * Matrix-vector product, row major.
+   */
+  void
+  gemv (const int8_t* matrix, const int8_t* x, int32_t* y, size_t rows,
+        size_t columns);
+
+  void
+  gemv (const float16_t* matrix, const float16_t* x, float* y, size_t rows,
+        size_t columns);
+
+  /**
+   * False if `count` is 0.
+   */
+  bool
+  min_max (const float* data, size_t count, float& min, float& max);
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::dsp
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_DSP_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,176 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_EXCEPTIONS_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_EXCEPTIONS_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/exceptions.h>
+#include <micro-os-plus/architecture-aarch64/smp-inlines.h>
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the AArch64 exceptions and interrupts.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_exception_vectors_install (void)
+  {
+    __asm__ volatile(
+
+        " msr vbar_el1, %[vectors] \n"
+        " isb \n"
+
+        : /* Outputs */
+        : [vectors] "r"(aarch64_architecture_exception_vectors) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_interrupts_enable (void)
+  {
+    __asm__ volatile(
+
+        " msr daifclr, #2 "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_interrupts_disable (void)
+  {
+    __asm__ volatile(
+
+        " msr daifset, #2 "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) aarch64_architecture_register_t
+  aarch64_architecture_interrupts_save_and_disable (void)
+  {
+    aarch64_architecture_register_t daif;
+
+    __asm__ volatile(
+
+        " mrs %[daif], daif \n"
+        " msr daifset, #2 \n"
+
+        : [daif] "=r"(daif) /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+
+    return daif;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_interrupts_restore (
+      aarch64_architecture_register_t daif)
+  {
+    __asm__ volatile(
+
+        " msr daif, %[daif] "
+
+        : /* Outputs */
+        : [daif] "r"(daif) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_interrupts_request_context_switch (void)
+  {
+    aarch64_architecture_interrupts_context_switch_pending
+        [aarch64_architecture_get_core_id ()]
+        = 1;
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  aarch64_architecture_interrupts_take_context_switch_request (void)
+  {
+    uint32_t core = aarch64_architecture_get_core_id ();
+    uint32_t pending
+        = aarch64_architecture_interrupts_context_switch_pending[core];
+    aarch64_architecture_interrupts_context_switch_pending[core] = 0;
+    return pending;
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::interrupts
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) void
+  enable (void)
+  {
+    aarch64_architecture_interrupts_enable ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  disable (void)
+  {
+    aarch64_architecture_interrupts_disable ();
+  }
+
+  inline __attribute__ ((always_inline)) register_t
+  save_and_disable (void)
+  {
+    return aarch64_architecture_interrupts_save_and_disable ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  restore (register_t daif)
+  {
+    aarch64_architecture_interrupts_restore (daif);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  request_context_switch (void)
+  {
+    aarch64_architecture_interrupts_request_context_switch ();
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::interrupts
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_EXCEPTIONS_INLINES_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,293 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_EXCEPTIONS_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_EXCEPTIONS_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/defines.h>
+#include <micro-os-plus/architecture-aarch64/smp.h>
+
+// ----------------------------------------------------------------------------
+// Definitions shared by the EL1 vector table (exception-vectors.S)
+// and the C/C++ code.
+//
+// The vector table is included only when
+// MICRO_OS_PLUS_INCLUDE_EXCEPTION_VECTORS is defined.
+//
+// IRQs take a fast path that saves only the registers not preserved
+// by the AAPCS64 callee, then call aarch64_architecture_interrupt_handler().
+// The callee-saved registers are also saved only when a context switch
+// was requested while the handler was running.
+//
+// The SIMD/FP caller-saved registers are saved only when
+// MICRO_OS_PLUS_USE_INTERRUPTS_FP_CONTEXT is defined; otherwise the
+// interrupt handlers must be compiled with -mgeneral-regs-only.
+
+// After a handler returns, if another IRQ is already pending, the
+// handler is called again without restoring/saving the frame,
+// up to this many times. 0 disables tail-chaining.
+#if !defined(MICRO_OS_PLUS_INTEGER_INTERRUPTS_TAIL_CHAIN_LIMIT)
+#define MICRO_OS_PLUS_INTEGER_INTERRUPTS_TAIL_CHAIN_LIMIT (4)
+#endif
+
+// Fast frame (caller-saved registers), offsets from SP.
+#define AARCH64_EXCEPTION_FRAME_X0 (0)
+#define AARCH64_EXCEPTION_FRAME_X18 (144)
+#define AARCH64_EXCEPTION_FRAME_FP (152)
+#define AARCH64_EXCEPTION_FRAME_LR (160)
+#define AARCH64_EXCEPTION_FRAME_ELR (168)
+#define AARCH64_EXCEPTION_FRAME_SPSR (176)
+#define AARCH64_EXCEPTION_FRAME_ESR (184)
+#define AARCH64_EXCEPTION_FRAME_GPR_SIZE (192)
+
+#if defined(MICRO_OS_PLUS_USE_INTERRUPTS_FP_CONTEXT)
+// q0-q7, q16-q31, fpcr, fpsr.
+#define AARCH64_EXCEPTION_FRAME_Q0 (AARCH64_EXCEPTION_FRAME_GPR_SIZE)
+#define AARCH64_EXCEPTION_FRAME_FPCR (AARCH64_EXCEPTION_FRAME_Q0 + 384)
+#define AARCH64_EXCEPTION_FRAME_SIZE (AARCH64_EXCEPTION_FRAME_Q0 + 400)
+#else
+#define AARCH64_EXCEPTION_FRAME_SIZE (AARCH64_EXCEPTION_FRAME_GPR_SIZE)
+#endif // defined(MICRO_OS_PLUS_USE_INTERRUPTS_FP_CONTEXT)
+
+// Full frame extension (callee-saved registers), stored below
+// the fast frame.
+#define AARCH64_EXCEPTION_FULL_FRAME_X19 (0)
+#define AARCH64_EXCEPTION_FULL_FRAME_SP_EL0 (80)
+#if defined(MICRO_OS_PLUS_USE_INTERRUPTS_FP_CONTEXT)
+#define AARCH64_EXCEPTION_FULL_FRAME_D8 (96)
+#define AARCH64_EXCEPTION_FULL_FRAME_EXTRA_SIZE (160)
+#else
+#define AARCH64_EXCEPTION_FULL_FRAME_EXTRA_SIZE (96)
+#endif // defined(MICRO_OS_PLUS_USE_INTERRUPTS_FP_CONTEXT)
+
+// SPSR_EL1.M[3:0], the mode of the interrupted code.
+#define AARCH64_SPSR_M_MASK (0xF)
+#define AARCH64_SPSR_M_EL0T (0x0)
+#define AARCH64_SPSR_M_EL1T (0x4)
+#define AARCH64_SPSR_M_EL1H (0x5)
+
+// Vector table entries, as passed to the exception handler.
+#define AARCH64_EXCEPTION_CURRENT_SP0_SYNC (0)
+#define AARCH64_EXCEPTION_CURRENT_SP0_IRQ (1)
+#define AARCH64_EXCEPTION_CURRENT_SP0_FIQ (2)
+#define AARCH64_EXCEPTION_CURRENT_SP0_SERROR (3)
+#define AARCH64_EXCEPTION_CURRENT_SPX_SYNC (4)
+#define AARCH64_EXCEPTION_CURRENT_SPX_IRQ (5)
+#define AARCH64_EXCEPTION_CURRENT_SPX_FIQ (6)
+#define AARCH64_EXCEPTION_CURRENT_SPX_SERROR (7)
+#define AARCH64_EXCEPTION_LOWER_A64_SYNC (8)
+#define AARCH64_EXCEPTION_LOWER_A64_IRQ (9)
+#define AARCH64_EXCEPTION_LOWER_A64_FIQ (10)
+#define AARCH64_EXCEPTION_LOWER_A64_SERROR (11)
+#define AARCH64_EXCEPTION_LOWER_A32_SYNC (12)
+#define AARCH64_EXCEPTION_LOWER_A32_IRQ (13)
+#define AARCH64_EXCEPTION_LOWER_A32_FIQ (14)
+#define AARCH64_EXCEPTION_LOWER_A32_SERROR (15)
+
+#if !defined(__ASSEMBLER__)
+
+#include <micro-os-plus/architecture-aarch64/types.h>
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  /**
+   * Registers saved on the fast path; AArch64 ABI caller-saved registers.
+   */
+  typedef struct aarch64_architecture_exception_frame_s
+  {
+    uint64_t x[19]; // x0-x18
+    uint64_t fp; // x29
+    uint64_t lr; // x30
+    uint64_t elr;
+    uint64_t spsr;
+    uint64_t esr; // Also the tail-chain counter for IRQs.
+#if defined(MICRO_OS_PLUS_USE_INTERRUPTS_FP_CONTEXT)
+    __uint128_t q0_q7[8];
+    __uint128_t q16_q31[16];
+    uint64_t fpcr;
+    uint64_t fpsr;
+#endif // defined(MICRO_OS_PLUS_USE_INTERRUPTS_FP_CONTEXT)
+  } aarch64_architecture_exception_frame_t;
+
+  /**
+   * The full context; the callee-saved registers below the fast frame.
+   */
+  typedef struct aarch64_architecture_exception_full_frame_s
+  {
+    uint64_t x19_x28[10];
+    uint64_t sp_el0;
+    uint64_t reserved;
+#if defined(MICRO_OS_PLUS_USE_INTERRUPTS_FP_CONTEXT)
+    uint64_t d8_d15[8];
+#endif // defined(MICRO_OS_PLUS_USE_INTERRUPTS_FP_CONTEXT)
+    aarch64_architecture_exception_frame_t frame;
+  } aarch64_architecture_exception_full_frame_t;
+
+  /**
+   * The EL1 vector table, 2 KB aligned.
+   */
+  extern const uint32_t aarch64_architecture_exception_vectors[];
+
+  /**
+   * Non-zero when a context switch must be performed on the
+   * return from the current interrupt, indexed by the
+   * aarch64_architecture_get_core_id() core number.
+   */
+  extern volatile uint32_t
+      aarch64_architecture_interrupts_context_switch_pending
+          [MICRO_OS_PLUS_INTEGER_SMP_MAX_CORES];
+
+  // --------------------------------------------------------------------------
+  // Handlers called from the vector table; all are weak and
+  // expected to be redefined by the application or the RTOS port.
+
+  /**
+   * Called for each IRQ, with interrupts disabled.
+   */
+  void
+  aarch64_architecture_interrupt_handler (
+      aarch64_architecture_exception_frame_t* frame);
+
+  /**
+   * Called before returning from an IRQ when a context switch was
+   * requested. Returns the full frame of the context to resume.
+   * With the interrupts stack, a frame from EL0 is on the interrupts
+   * stack; it must be copied to the thread storage, and the returned
+   * frame is copied over it.
+   */
+  aarch64_architecture_exception_full_frame_t*
+  aarch64_architecture_interrupt_context_switch (
+      aarch64_architecture_exception_full_frame_t* frame);
+
+  /**
+   * Called for synchronous exceptions, FIQ, SError and all exceptions
+   * from AArch32; `kind` is the vector table entry index.
+   */
+  void
+  aarch64_architecture_exception_handler (
+      aarch64_architecture_exception_full_frame_t* frame, uint32_t kind);
+
+  // --------------------------------------------------------------------------
+  // Exceptions and interrupts control in C.
+
+  /**
+   * Set VBAR_EL1 to the package vector table.
+   */
+  static void
+  aarch64_architecture_exception_vectors_install (void);
+
+  /**
+   * Unmask IRQs in PSTATE.
+   */
+  static void
+  aarch64_architecture_interrupts_enable (void);
+
+  /**
+   * Mask IRQs in PSTATE.
+   */
+  static void
+  aarch64_architecture_interrupts_disable (void);
+
+  /**
+   * Mask IRQs in PSTATE and return the previous DAIF.
+   */
+  static aarch64_architecture_register_t
+  aarch64_architecture_interrupts_save_and_disable (void);
+
+  /**
+   * Restore DAIF.
+   */
+  static void
+  aarch64_architecture_interrupts_restore (
+      aarch64_architecture_register_t daif);
+
+  /**
+   * Request a context switch on the return from the current interrupt.
+   */
+  static void
+  aarch64_architecture_interrupts_request_context_switch (void);
+
+  /**
+   * Return and clear the context switch request of the current core.
+   */
+  static uint32_t
+  aarch64_architecture_interrupts_take_context_switch_request (void);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::interrupts
+{
+  // --------------------------------------------------------------------------
+  // Interrupts control in C++.
+
+  using frame_t = aarch64_architecture_exception_frame_t;
+  using full_frame_t = aarch64_architecture_exception_full_frame_t;
+
+  /**
+   * Unmask IRQs.
+   */
+  void
+  enable (void);
+
+  /**
+   * Mask IRQs.
+   */
+  void
+  disable (void);
+
+  /**
+   * Mask IRQs and return the previous state.
+   */
+  register_t
+  save_and_disable (void);
+
+  /**
+   * Restore the state returned by save_and_disable().
+   */
+  void
+  restore (register_t daif);
+
+  /**
+   * Request a context switch on the return from the current interrupt.
+   */
+  void
+  request_context_switch (void);
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::interrupts
+
+#endif // defined(__cplusplus)
+
+#endif // !defined(__ASSEMBLER__)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_EXCEPTIONS_H_
+
+// ----------------------------------------------------------------------------
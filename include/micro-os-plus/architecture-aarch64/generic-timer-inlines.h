@@ -0,0 +1,291 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_GENERIC_TIMER_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_GENERIC_TIMER_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/generic-timer.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the ARM Generic Timer.
+
+#if defined(MICRO_OS_PLUS_USE_GENERIC_TIMER_PHYSICAL)
+#define AARCH64_GENERIC_TIMER_COUNTER "cntpct_el0"
+// CNTPCTSS_EL0, by encoding, for assemblers without ARMv8.6.
+#define AARCH64_GENERIC_TIMER_COUNTER_SS "s3_3_c14_c0_5"
+#define AARCH64_GENERIC_TIMER_CVAL "cntp_cval_el0"
+#define AARCH64_GENERIC_TIMER_CTL "cntp_ctl_el0"
+#else
+#define AARCH64_GENERIC_TIMER_COUNTER "cntvct_el0"
+// CNTVCTSS_EL0.
+#define AARCH64_GENERIC_TIMER_COUNTER_SS "s3_3_c14_c0_6"
+#define AARCH64_GENERIC_TIMER_CVAL "cntv_cval_el0"
+#define AARCH64_GENERIC_TIMER_CTL "cntv_ctl_el0"
+#endif // defined(MICRO_OS_PLUS_USE_GENERIC_TIMER_PHYSICAL)
+
+// CNTx_CTL_EL0 bits.
+#define AARCH64_GENERIC_TIMER_CTL_ENABLE (1U << 0)
+#define AARCH64_GENERIC_TIMER_CTL_IMASK (1U << 1)
+#define AARCH64_GENERIC_TIMER_CTL_ISTATUS (1U << 2)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  aarch64_architecture_generic_timer_get_frequency (void)
+  {
+    uint64_t result;
+
+    __asm__ volatile(
+
+        " mrs %[result], cntfrq_el0 "
+
+        : [result] "=r"(result) /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+
+    return (uint32_t)result;
+  }
+
+  static inline __attribute__ ((always_inline)) uint64_t
+  aarch64_architecture_generic_timer_get_counter (void)
+  {
+    uint64_t result;
+
+#if defined(MICRO_OS_PLUS_USE_GENERIC_TIMER_SELF_SYNCHRONIZED)
+    // The self-synchronised view is not read speculatively.
+    __asm__ volatile(
+
+        " mrs %[result], " AARCH64_GENERIC_TIMER_COUNTER_SS " \n"
+
+        : [result] "=r"(result) /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+#else
+    // Without the `isb` the counter may be read speculatively,
+    // ahead of the code being measured.
+    __asm__ volatile(
+
+        " isb \n"
+        " mrs %[result], " AARCH64_GENERIC_TIMER_COUNTER " \n"
+
+        : [result] "=r"(result) /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+#endif // defined(MICRO_OS_PLUS_USE_GENERIC_TIMER_SELF_SYNCHRONIZED)
+
+    return result;
+  }
+
+  static inline __attribute__ ((always_inline)) uint64_t
+  aarch64_architecture_generic_timer_get_compare (void)
+  {
+    uint64_t result;
+
+    __asm__ volatile(
+
+        " mrs %[result], " AARCH64_GENERIC_TIMER_CVAL " "
+
+        : [result] "=r"(result) /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+
+    return result;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_generic_timer_set_compare (uint64_t value)
+  {
+    __asm__ volatile(
+
+        " msr " AARCH64_GENERIC_TIMER_CVAL ", %[value] "
+
+        : /* Outputs */
+        : [value] "r"(value) /* Inputs */
+        : /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_generic_timer_enable (void)
+  {
+    __asm__ volatile(
+
+        " msr " AARCH64_GENERIC_TIMER_CTL ", %[ctl] \n"
+        " isb \n"
+
+        : /* Outputs */
+        : [ctl] "r"((uint64_t)AARCH64_GENERIC_TIMER_CTL_ENABLE) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_generic_timer_disable (void)
+  {
+    __asm__ volatile(
+
+        " msr " AARCH64_GENERIC_TIMER_CTL ", xzr \n"
+        " isb \n"
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) bool
+  aarch64_architecture_generic_timer_is_pending (void)
+  {
+    uint64_t ctl;
+
+    __asm__ volatile(
+
+        " mrs %[ctl], " AARCH64_GENERIC_TIMER_CTL " "
+
+        : [ctl] "=r"(ctl) /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+
+    return (ctl & AARCH64_GENERIC_TIMER_CTL_ISTATUS) != 0;
+  }
+
+  static inline __attribute__ ((always_inline)) uint64_t
+  aarch64_architecture_generic_timer_sleep_until (uint64_t deadline)
+  {
+    uint64_t begin = aarch64_architecture_generic_timer_get_counter ();
+    if (deadline <= begin)
+      {
+        return 0;
+      }
+
+    aarch64_architecture_generic_timer_set_compare (deadline);
+    aarch64_architecture_generic_timer_enable ();
+
+    // Complete all outstanding memory accesses before sleeping.
+    __asm__ volatile(
+
+        " dsb sy \n"
+        " wfi \n"
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+
+    uint64_t end = aarch64_architecture_generic_timer_get_counter ();
+
+    // One-shot: drop the (level sensitive) timer interrupt request.
+    aarch64_architecture_generic_timer_disable ();
+
+    return end - begin;
+  }
+
+  static inline __attribute__ ((always_inline)) uint64_t
+  aarch64_architecture_generic_timer_sleep_for (uint64_t ticks)
+  {
+    return aarch64_architecture_generic_timer_sleep_until (
+        aarch64_architecture_generic_timer_get_counter () + ticks);
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::generic_timer
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) uint32_t
+  frequency (void)
+  {
+    return aarch64_architecture_generic_timer_get_frequency ();
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  counter (void)
+  {
+    return aarch64_architecture_generic_timer_get_counter ();
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  compare (void)
+  {
+    return aarch64_architecture_generic_timer_get_compare ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  compare (uint64_t value)
+  {
+    aarch64_architecture_generic_timer_set_compare (value);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  enable (void)
+  {
+    aarch64_architecture_generic_timer_enable ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  disable (void)
+  {
+    aarch64_architecture_generic_timer_disable ();
+  }
+
+  inline __attribute__ ((always_inline)) bool
+  pending (void)
+  {
+    return aarch64_architecture_generic_timer_is_pending ();
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  sleep_until (uint64_t deadline)
+  {
+    return aarch64_architecture_generic_timer_sleep_until (deadline);
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  sleep_for (uint64_t ticks)
+  {
+    return aarch64_architecture_generic_timer_sleep_for (ticks);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::generic_timer
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_GENERIC_TIMER_INLINES_H_
+
+// ----------------------------------------------------------------------------
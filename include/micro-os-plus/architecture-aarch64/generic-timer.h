@@ -0,0 +1,183 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_GENERIC_TIMER_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_GENERIC_TIMER_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/defines.h>
+#include <micro-os-plus/architecture-aarch64/types.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Declarations of the ARM Generic Timer functions.
+//
+// By default the EL1 virtual timer (CNTV_*) is used; define
+// MICRO_OS_PLUS_USE_GENERIC_TIMER_PHYSICAL to use the EL1 physical
+// timer (CNTP_*) instead.
+//
+// On cores with FEAT_ECV (mandatory from ARMv8.6), define
+// MICRO_OS_PLUS_USE_GENERIC_TIMER_SELF_SYNCHRONIZED to read the ordered
+// counter from CNTVCTSS_EL0 (or CNTPCTSS_EL0), without the `isb`.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+  // Generic Timer in C.
+
+  /**
+   * Counter frequency in Hz (CNTFRQ_EL0).
+   */
+  static uint32_t
+  aarch64_architecture_generic_timer_get_frequency (void);
+
+  /**
+   * Counter getter (CNTVCT_EL0 or CNTPCT_EL0), ordered after
+   * the previous instructions.
+   */
+  static uint64_t
+  aarch64_architecture_generic_timer_get_counter (void);
+
+  /**
+   * Compare value getter (CNTV_CVAL_EL0 or CNTP_CVAL_EL0).
+   */
+  static uint64_t
+  aarch64_architecture_generic_timer_get_compare (void);
+
+  /**
+   * Compare value setter (CNTV_CVAL_EL0 or CNTP_CVAL_EL0).
+   */
+  static void
+  aarch64_architecture_generic_timer_set_compare (uint64_t value);
+
+  /**
+   * Enable the timer with its interrupt unmasked.
+   */
+  static void
+  aarch64_architecture_generic_timer_enable (void);
+
+  /**
+   * Disable the timer, which also deasserts its interrupt.
+   */
+  static void
+  aarch64_architecture_generic_timer_disable (void);
+
+  /**
+   * Check if the timer condition is met (CTL.ISTATUS).
+   */
+  static bool
+  aarch64_architecture_generic_timer_is_pending (void);
+
+  /**
+   * Program a one-shot deadline, enter `wfi` and, after wake-up,
+   * disable the timer. Returns the number of counter ticks actually
+   * spent asleep, which may be less than requested if another
+   * interrupt woke the core.
+   *
+   * Intended for tickless idle; call it with IRQs masked in PSTATE,
+   * so the accounting is done before the handlers run; the timer
+   * interrupt must be enabled in the interrupt controller.
+   */
+  static uint64_t
+  aarch64_architecture_generic_timer_sleep_until (uint64_t deadline);
+
+  /**
+   * Same as above, with the deadline relative to the current counter.
+   */
+  static uint64_t
+  aarch64_architecture_generic_timer_sleep_for (uint64_t ticks);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::generic_timer
+{
+  // --------------------------------------------------------------------------
+  // Generic Timer in C++.
+
+  /**
+   * Counter frequency in Hz.
+   */
+  uint32_t
+  frequency (void);
+
+  /**
+   * Counter getter.
+   */
+  uint64_t
+  counter (void);
+
+  /**
+   * Compare value getter.
+   */
+  uint64_t
+  compare (void);
+
+  /**
+   * Compare value setter.
+   */
+  void
+  compare (uint64_t value);
+
+  /**
+   * Enable the timer with its interrupt unmasked.
+   */
+  void
+  enable (void);
+
+  /**
+   * Disable the timer.
+   */
+  void
+  disable (void);
+
+  /**
+   * Check if the timer condition is met.
+   */
+  bool
+  pending (void);
+
+  /**
+   * Sleep until the counter reaches `deadline`; return the ticks slept.
+   */
+  uint64_t
+  sleep_until (uint64_t deadline);
+
+  /**
+   * Sleep for `ticks`; return the ticks slept.
+   */
+  uint64_t
+  sleep_for (uint64_t ticks);
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::generic_timer
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_GENERIC_TIMER_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,302 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_GIC_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_GIC_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/gic.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the ARM GICv3 CPU interface.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  aarch64_architecture_gic_acknowledge (void)
+  {
+    uint64_t result;
+
+    // The acknowledge must complete before the handler accesses
+    // the device.
+    __asm__ volatile(
+
+        " mrs %[result], icc_iar1_el1 \n"
+        " dsb sy \n"
+
+        : [result] "=r"(result) /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+
+    return (uint32_t)result;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_gic_end_of_interrupt (uint32_t intid)
+  {
+    __asm__ volatile(
+
+        " msr icc_eoir1_el1, %[intid] "
+
+        : /* Outputs */
+        : [intid] "r"((uint64_t)intid) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  aarch64_architecture_gic_get_priority_mask (void)
+  {
+    uint64_t result;
+
+    __asm__ volatile(
+
+        " mrs %[result], icc_pmr_el1 "
+
+        : [result] "=r"(result) /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+
+    return (uint32_t)result;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_gic_set_priority_mask (uint32_t mask)
+  {
+    // PMR writes are self-synchronising with respect to the
+    // interrupts signalled to the core; the memory clobber keeps
+    // the critical section accesses after it.
+    __asm__ volatile(
+
+        " msr icc_pmr_el1, %[mask] "
+
+        : /* Outputs */
+        : [mask] "r"((uint64_t)mask) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  aarch64_architecture_gic_raise_priority_mask (uint32_t mask)
+  {
+    uint32_t previous = aarch64_architecture_gic_get_priority_mask ();
+    if (mask < previous)
+      {
+        aarch64_architecture_gic_set_priority_mask (mask);
+      }
+    return previous;
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  aarch64_architecture_gic_get_running_priority (void)
+  {
+    uint64_t result;
+
+    __asm__ volatile(
+
+        " mrs %[result], icc_rpr_el1 "
+
+        : [result] "=r"(result) /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+
+    return (uint32_t)result;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_gic_set_binary_point (uint32_t point)
+  {
+    __asm__ volatile(
+
+        " msr icc_bpr1_el1, %[point] \n"
+        " isb \n"
+
+        : /* Outputs */
+        : [point] "r"((uint64_t)point) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_gic_write_sgi1r (uint64_t value)
+  {
+    // Make the data for the target core visible before the SGI.
+    __asm__ volatile(
+
+        " dsb ishst \n"
+        " msr icc_sgi1r_el1, %[value] \n"
+        " isb \n"
+
+        : /* Outputs */
+        : [value] "r"(value) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_gic_send_sgi (uint32_t intid,
+                                     aarch64_architecture_register_t mpidr)
+  {
+    // The target list has 16 bits, for Aff0 modulo 16; RS selects
+    // the range.
+    uint64_t aff0 = mpidr & 0xFF;
+    uint64_t value = ((uint64_t)(intid & 0xF) << AARCH64_ICC_SGI1R_INTID_SHIFT)
+                     | (1ULL << (aff0 & 0xF))
+                     | ((aff0 >> 4) << AARCH64_ICC_SGI1R_RS_SHIFT)
+                     | (((mpidr >> 8) & 0xFF) << AARCH64_ICC_SGI1R_AFF1_SHIFT)
+                     | (((mpidr >> 16) & 0xFF) << AARCH64_ICC_SGI1R_AFF2_SHIFT)
+                     | (((mpidr >> 32) & 0xFF)
+                        << AARCH64_ICC_SGI1R_AFF3_SHIFT);
+
+    aarch64_architecture_gic_write_sgi1r (value);
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_gic_send_sgi_to_others (uint32_t intid)
+  {
+    aarch64_architecture_gic_write_sgi1r (
+        ((uint64_t)(intid & 0xF) << AARCH64_ICC_SGI1R_INTID_SHIFT)
+        | AARCH64_ICC_SGI1R_IRM);
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::gic
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) void
+  initialize (void)
+  {
+    aarch64_architecture_gic_initialize ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  cpu_initialize (void)
+  {
+    aarch64_architecture_gic_cpu_initialize ();
+  }
+
+  inline __attribute__ ((always_inline)) bool
+  handler (uint32_t intid, handler_t handler, void* arg)
+  {
+    return aarch64_architecture_gic_set_handler (intid, handler, arg);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  enable (uint32_t intid)
+  {
+    aarch64_architecture_gic_enable (intid);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  disable (uint32_t intid)
+  {
+    aarch64_architecture_gic_disable (intid);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  priority (uint32_t intid, uint32_t priority)
+  {
+    aarch64_architecture_gic_set_priority (intid, priority);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  edge_triggered (uint32_t intid, bool edge)
+  {
+    aarch64_architecture_gic_set_edge_triggered (intid, edge);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  affinity (uint32_t intid, register_t mpidr)
+  {
+    aarch64_architecture_gic_set_affinity (intid, mpidr);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  affinity_any (uint32_t intid)
+  {
+    aarch64_architecture_gic_set_affinity_any (intid);
+  }
+
+  inline __attribute__ ((always_inline)) uint32_t
+  priority_mask (void)
+  {
+    return aarch64_architecture_gic_get_priority_mask ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  priority_mask (uint32_t mask)
+  {
+    aarch64_architecture_gic_set_priority_mask (mask);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  binary_point (uint32_t point)
+  {
+    aarch64_architecture_gic_set_binary_point (point);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  send_sgi (uint32_t intid, register_t mpidr)
+  {
+    aarch64_architecture_gic_send_sgi (intid, mpidr);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  send_sgi_to_others (uint32_t intid)
+  {
+    aarch64_architecture_gic_send_sgi_to_others (intid);
+  }
+
+  inline __attribute__ ((always_inline))
+  priority_mask_guard::priority_mask_guard (uint32_t mask)
+      : previous_{ aarch64_architecture_gic_raise_priority_mask (mask) }
+  {
+  }
+
+  inline __attribute__ ((always_inline))
+  priority_mask_guard::~priority_mask_guard ()
+  {
+    aarch64_architecture_gic_set_priority_mask (previous_);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::gic
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_GIC_INLINES_H_
+
+// ----------------------------------------------------------------------------
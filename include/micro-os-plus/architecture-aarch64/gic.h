@@ -0,0 +1,424 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_GIC_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_GIC_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/defines.h>
+#include <micro-os-plus/architecture-aarch64/types.h>
+#include <micro-os-plus/architecture-aarch64/exceptions.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Declarations of the ARM GICv3 interrupt controller driver.
+//
+// The distributor (GICD) and the redistributors (GICR) are memory
+// mapped; the CPU interface is accessed only via the ICC_*_EL1 system
+// registers, which is much faster than the GICv2 memory-mapped
+// interface, with all interrupts in Group 1 (non-secure).
+//
+// When MICRO_OS_PLUS_INCLUDE_GIC is defined, the driver provides
+// aarch64_architecture_interrupt_handler(), which acknowledges the
+// interrupt, calls the handler registered for its INTID in a table
+// indexed by INTID, and signals the end of interrupt.
+//
+// The CPU interface blocks the interrupts with the same or lower
+// priority than the running one. With
+// MICRO_OS_PLUS_USE_GIC_NESTED_INTERRUPTS, IRQs are unmasked in
+// PSTATE while the handler runs, so higher priority interrupts
+// preempt it; the group priority is selected with
+// aarch64_architecture_gic_set_binary_point(). The context switch
+// requests are deferred until the outermost handler returns.
+//
+// The default addresses are those of QEMU `-M virt,gic-version=3`.
+
+#if !defined(MICRO_OS_PLUS_INTEGER_GIC_DISTRIBUTOR_ADDRESS)
+#define MICRO_OS_PLUS_INTEGER_GIC_DISTRIBUTOR_ADDRESS (0x08000000)
+#endif // !defined(MICRO_OS_PLUS_INTEGER_GIC_DISTRIBUTOR_ADDRESS)
+
+#if !defined(MICRO_OS_PLUS_INTEGER_GIC_REDISTRIBUTOR_ADDRESS)
+#define MICRO_OS_PLUS_INTEGER_GIC_REDISTRIBUTOR_ADDRESS (0x080A0000)
+#endif // !defined(MICRO_OS_PLUS_INTEGER_GIC_REDISTRIBUTOR_ADDRESS)
+
+// The number of entries in the dispatch table; INTIDs above it are
+// treated as spurious.
+#if !defined(MICRO_OS_PLUS_INTEGER_GIC_MAX_INTERRUPTS)
+#define MICRO_OS_PLUS_INTEGER_GIC_MAX_INTERRUPTS (256)
+#endif // !defined(MICRO_OS_PLUS_INTEGER_GIC_MAX_INTERRUPTS)
+
+// The priority of all interrupts after initialisation; lower values
+// have higher priorities, and only the upper bits may be implemented.
+#if !defined(MICRO_OS_PLUS_INTEGER_GIC_DEFAULT_PRIORITY)
+#define MICRO_OS_PLUS_INTEGER_GIC_DEFAULT_PRIORITY (0xA0)
+#endif // !defined(MICRO_OS_PLUS_INTEGER_GIC_DEFAULT_PRIORITY)
+
+// INTID ranges.
+#define AARCH64_GIC_SGI_FIRST (0)
+#define AARCH64_GIC_PPI_FIRST (16)
+#define AARCH64_GIC_SPI_FIRST (32)
+#define AARCH64_GIC_SPURIOUS_FIRST (1020)
+
+// Generic timer PPIs.
+#define AARCH64_GIC_INTID_TIMER_PHYSICAL (30)
+#define AARCH64_GIC_INTID_TIMER_VIRTUAL (27)
+#define AARCH64_GIC_INTID_PMU (23)
+
+// Distributor registers, offsets from the base.
+#define AARCH64_GICD_CTLR (0x0000)
+#define AARCH64_GICD_TYPER (0x0004)
+#define AARCH64_GICD_IGROUPR (0x0080)
+#define AARCH64_GICD_ISENABLER (0x0100)
+#define AARCH64_GICD_ICENABLER (0x0180)
+#define AARCH64_GICD_ISPENDR (0x0200)
+#define AARCH64_GICD_ICPENDR (0x0280)
+#define AARCH64_GICD_ICACTIVER (0x0380)
+#define AARCH64_GICD_IPRIORITYR (0x0400)
+#define AARCH64_GICD_ICFGR (0x0C00)
+#define AARCH64_GICD_IGRPMODR (0x0D00)
+#define AARCH64_GICD_IROUTER (0x6000)
+
+#define AARCH64_GICD_CTLR_ENABLE_GRP0 (1U << 0)
+#define AARCH64_GICD_CTLR_ENABLE_GRP1 (1U << 1)
+#define AARCH64_GICD_CTLR_ARE (1U << 4)
+#define AARCH64_GICD_CTLR_RWP (1U << 31)
+
+#define AARCH64_GICD_IROUTER_ANY (1ULL << 31)
+
+// Redistributor registers; each core has a 64 KB RD frame followed
+// by a 64 KB SGI frame.
+#define AARCH64_GICR_STRIDE (0x20000)
+#define AARCH64_GICR_SGI_BASE (0x10000)
+
+#define AARCH64_GICR_CTLR (0x0000)
+#define AARCH64_GICR_TYPER (0x0008)
+#define AARCH64_GICR_WAKER (0x0014)
+
+#define AARCH64_GICR_CTLR_RWP (1U << 3)
+#define AARCH64_GICR_TYPER_LAST (1U << 4)
+#define AARCH64_GICR_WAKER_PROCESSOR_SLEEP (1U << 1)
+#define AARCH64_GICR_WAKER_CHILDREN_ASLEEP (1U << 2)
+
+// ICC_SRE_EL1 bits.
+#define AARCH64_ICC_SRE_SRE (1U << 0)
+
+// ICC_SGI1R_EL1 fields.
+#define AARCH64_ICC_SGI1R_INTID_SHIFT (24)
+#define AARCH64_ICC_SGI1R_AFF1_SHIFT (16)
+#define AARCH64_ICC_SGI1R_AFF2_SHIFT (32)
+#define AARCH64_ICC_SGI1R_IRM (1ULL << 40)
+#define AARCH64_ICC_SGI1R_RS_SHIFT (44)
+#define AARCH64_ICC_SGI1R_AFF3_SHIFT (48)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  /**
+   * Interrupt handler, called with the registered argument and
+   * the frame of the interrupted context.
+   */
+  typedef void (*aarch64_architecture_gic_handler_t) (
+      void* arg, aarch64_architecture_exception_frame_t* frame);
+
+  // --------------------------------------------------------------------------
+  // GICv3 CPU interface in C (system registers).
+
+  /**
+   * Acknowledge the highest priority pending Group 1 interrupt
+   * (ICC_IAR1_EL1); return its INTID, or 1023 if none.
+   */
+  static uint32_t
+  aarch64_architecture_gic_acknowledge (void);
+
+  /**
+   * Signal the end of the interrupt (ICC_EOIR1_EL1); drops the
+   * running priority and deactivates it.
+   */
+  static void
+  aarch64_architecture_gic_end_of_interrupt (uint32_t intid);
+
+  /**
+   * Priority mask getter (ICC_PMR_EL1).
+   */
+  static uint32_t
+  aarch64_architecture_gic_get_priority_mask (void);
+
+  /**
+   * Priority mask setter (ICC_PMR_EL1); only interrupts with a higher
+   * priority (lower value) than the mask are signalled.
+   */
+  static void
+  aarch64_architecture_gic_set_priority_mask (uint32_t mask);
+
+  /**
+   * Lower the priority mask to `mask`, if it masks more than the
+   * current one, and return the previous mask. Use it for critical
+   * sections that keep the higher priority interrupts enabled.
+   */
+  static uint32_t
+  aarch64_architecture_gic_raise_priority_mask (uint32_t mask);
+
+  /**
+   * Running priority getter (ICC_RPR_EL1); 0xFF when idle.
+   */
+  static uint32_t
+  aarch64_architecture_gic_get_running_priority (void);
+
+  /**
+   * Binary point setter (ICC_BPR1_EL1); the priority bits above it
+   * form the group priority, used for preemption.
+   */
+  static void
+  aarch64_architecture_gic_set_binary_point (uint32_t point);
+
+  /**
+   * SGI Group 1 Register setter (ICC_SGI1R_EL1), after making the
+   * previous stores visible.
+   */
+  static void
+  aarch64_architecture_gic_write_sgi1r (uint64_t value);
+
+  /**
+   * Send a Group 1 SGI to the core with the given MPIDR affinity.
+   */
+  static void
+  aarch64_architecture_gic_send_sgi (uint32_t intid,
+                                     aarch64_architecture_register_t mpidr);
+
+  /**
+   * Send a Group 1 SGI to all other cores.
+   */
+  static void
+  aarch64_architecture_gic_send_sgi_to_others (uint32_t intid);
+
+  // --------------------------------------------------------------------------
+  // GICv3 driver in C.
+
+  /**
+   * Initialise the distributor, then the current core.
+   * To be called once, by the primary core, with IRQs masked.
+   * All interrupts are disabled, in Group 1, at the default priority,
+   * level-sensitive, and the SPIs are routed to the current core.
+   */
+  void
+  aarch64_architecture_gic_initialize (void);
+
+  /**
+   * Wake up the redistributor and enable the CPU interface of the
+   * current core. To be called by each secondary core.
+   */
+  void
+  aarch64_architecture_gic_cpu_initialize (void);
+
+  /**
+   * Register the handler for an INTID; return false if out of range.
+   */
+  bool
+  aarch64_architecture_gic_set_handler (
+      uint32_t intid, aarch64_architecture_gic_handler_t handler, void* arg);
+
+  /**
+   * Enable the interrupt; SGIs and PPIs on the current core.
+   */
+  void
+  aarch64_architecture_gic_enable (uint32_t intid);
+
+  /**
+   * Disable the interrupt; SGIs and PPIs on the current core.
+   */
+  void
+  aarch64_architecture_gic_disable (uint32_t intid);
+
+  /**
+   * Set the priority; lower values have higher priorities.
+   */
+  void
+  aarch64_architecture_gic_set_priority (uint32_t intid, uint32_t priority);
+
+  /**
+   * Make the interrupt edge-triggered, or level-sensitive.
+   * SGIs are always edge-triggered.
+   */
+  void
+  aarch64_architecture_gic_set_edge_triggered (uint32_t intid, bool edge);
+
+  /**
+   * Route an SPI to the core with the given MPIDR affinity.
+   */
+  void
+  aarch64_architecture_gic_set_affinity (
+      uint32_t intid, aarch64_architecture_register_t mpidr);
+
+  /**
+   * Route an SPI to any core that has the interrupts enabled.
+   */
+  void
+  aarch64_architecture_gic_set_affinity_any (uint32_t intid);
+
+  /**
+   * Set the interrupt pending.
+   */
+  void
+  aarch64_architecture_gic_set_pending (uint32_t intid);
+
+  /**
+   * Clear the pending state.
+   */
+  void
+  aarch64_architecture_gic_clear_pending (uint32_t intid);
+
+  /**
+   * Acknowledge and dispatch an interrupt, via the table.
+   * Called from aarch64_architecture_interrupt_handler().
+   */
+  void
+  aarch64_architecture_gic_dispatch (
+      aarch64_architecture_exception_frame_t* frame);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::gic
+{
+  // --------------------------------------------------------------------------
+  // GICv3 driver in C++.
+
+  using handler_t = aarch64_architecture_gic_handler_t;
+
+  /**
+   * Initialise the distributor and the current core.
+   */
+  void
+  initialize (void);
+
+  /**
+   * Initialise the current core.
+   */
+  void
+  cpu_initialize (void);
+
+  /**
+   * Register the handler for an INTID.
+   */
+  bool
+  handler (uint32_t intid, handler_t handler, void* arg = nullptr);
+
+  /**
+   * Enable the interrupt.
+   */
+  void
+  enable (uint32_t intid);
+
+  /**
+   * Disable the interrupt.
+   */
+  void
+  disable (uint32_t intid);
+
+  /**
+   * Set the priority.
+   */
+  void
+  priority (uint32_t intid, uint32_t priority);
+
+  /**
+   * Make the interrupt edge-triggered, or level-sensitive.
+   */
+  void
+  edge_triggered (uint32_t intid, bool edge);
+
+  /**
+   * Route an SPI to the core with the given MPIDR affinity.
+   */
+  void
+  affinity (uint32_t intid, register_t mpidr);
+
+  /**
+   * Route an SPI to any core.
+   */
+  void
+  affinity_any (uint32_t intid);
+
+  /**
+   * Priority mask getter.
+   */
+  uint32_t
+  priority_mask (void);
+
+  /**
+   * Priority mask setter.
+   */
+  void
+  priority_mask (uint32_t mask);
+
+  /**
+   * Binary point setter.
+   */
+  void
+  binary_point (uint32_t point);
+
+  /**
+   * Send an SGI to a core, by MPIDR affinity.
+   */
+  void
+  send_sgi (uint32_t intid, register_t mpidr);
+
+  /**
+   * Send an SGI to all other cores.
+   */
+  void
+  send_sgi_to_others (uint32_t intid);
+
+  /**
+   * Mask the interrupts with a priority equal or lower than
+   * the given one, while in scope.
+   */
+  class priority_mask_guard
+  {
+  public:
+    explicit priority_mask_guard (uint32_t mask);
+
+    priority_mask_guard (const priority_mask_guard&) = delete;
+    priority_mask_guard&
+    operator= (const priority_mask_guard&)
+        = delete;
+
+    ~priority_mask_guard ();
+
+  protected:
+    uint32_t previous_;
+  };
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::gic
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_GIC_H_
+
+// ----------------------------------------------------------------------------
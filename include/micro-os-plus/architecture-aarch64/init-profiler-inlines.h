@@ -0,0 +1,152 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_INIT_PROFILER_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_INIT_PROFILER_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/init-profiler.h>
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+#include <new>
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the AArch64 boot time profiler.
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::init_profiler
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) void
+  init_array (void)
+  {
+    aarch64_architecture_init_profiler_init_array ();
+  }
+
+  inline __attribute__ ((always_inline)) const entry*
+  entries (void)
+  {
+    return aarch64_architecture_init_profiler_get_entries ();
+  }
+
+  inline __attribute__ ((always_inline)) size_t
+  count (void)
+  {
+    return aarch64_architecture_init_profiler_get_count ();
+  }
+
+  inline __attribute__ ((always_inline)) size_t
+  dropped (void)
+  {
+    return aarch64_architecture_init_profiler_get_dropped_count ();
+  }
+
+  inline __attribute__ ((always_inline)) bool
+  write (const char* path)
+  {
+    return aarch64_architecture_init_profiler_write (path) == 0;
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::init_profiler
+
+namespace aarch64::architecture::startup
+{
+  // --------------------------------------------------------------------------
+
+  template <typename T>
+  inline __attribute__ ((always_inline)) T&
+  lazy<T>::get (void)
+  {
+    // Only the first use takes the slow path.
+    if (aarch64_architecture_load_acquire_32 (&state_) != state_constructed)
+      {
+        construct_slow ();
+      }
+
+    return *std::launder (reinterpret_cast<T*> (storage_));
+  }
+
+  template <typename T>
+  inline __attribute__ ((always_inline)) T&
+  lazy<T>::operator* (void)
+  {
+    return get ();
+  }
+
+  template <typename T>
+  inline __attribute__ ((always_inline)) T*
+  lazy<T>::operator->(void)
+  {
+    return &get ();
+  }
+
+  template <typename T>
+  inline __attribute__ ((always_inline)) bool
+  lazy<T>::is_constructed (void) const
+  {
+    return aarch64_architecture_load_acquire_32 (&state_)
+           == state_constructed;
+  }
+
+  template <typename T>
+  void
+  lazy<T>::construct (void* storage)
+  {
+    new (storage) T ();
+  }
+
+  template <typename T>
+  __attribute__ ((noinline)) void
+  lazy<T>::construct_slow (void)
+  {
+    if (aarch64_architecture_atomic_compare_exchange_32 (
+            &state_, state_none, state_constructing)
+        != state_none)
+      {
+        // Another core is constructing it; the release store
+        // of the state wakes up this one.
+        aarch64_architecture_wait_while_equal_32 (&state_,
+                                                  state_constructing);
+        return;
+      }
+
+#if defined(MICRO_OS_PLUS_INCLUDE_INIT_PROFILER)
+    uint64_t begin = aarch64_architecture_generic_timer_get_counter ();
+    construct (storage_);
+    aarch64_architecture_init_profiler_record (
+        AARCH64_INIT_PROFILER_KIND_LAZY,
+        reinterpret_cast<uintptr_t> (&lazy<T>::construct), begin,
+        aarch64_architecture_generic_timer_get_counter ());
+#else
+    construct (storage_);
+#endif // defined(MICRO_OS_PLUS_INCLUDE_INIT_PROFILER)
+
+    aarch64_architecture_store_release_32 (&state_, state_constructed);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::startup
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_INIT_PROFILER_INLINES_H_
+
+// ----------------------------------------------------------------------------
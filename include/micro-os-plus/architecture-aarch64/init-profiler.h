@@ -0,0 +1,233 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_INIT_PROFILER_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_INIT_PROFILER_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/defines.h>
+#include <micro-os-plus/architecture-aarch64/types.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Declarations of the AArch64 boot time profiler.
+//
+// An instrumented replacement for the newlib `__libc_init_array()`; it
+// runs the same functions, in the same order (the `.preinit_array`
+// buckets, `_init()`, then the `.init_array`), and records for each
+// one the address and the duration, measured with the generic timer
+// counter. The addresses can be resolved with `aarch64-none-elf-addr2line`.
+//
+// The table is written to the host as CSV, with the semihosting
+// file I/O.
+//
+// Objects of the C++ `startup::lazy<T>` type are constructed on first
+// use, not during startup; with the profiler included, their
+// construction is also recorded, with the `lazy` kind.
+
+// The number of entries in the table.
+#if !defined(MICRO_OS_PLUS_INTEGER_INIT_PROFILER_ENTRIES)
+#define MICRO_OS_PLUS_INTEGER_INIT_PROFILER_ENTRIES (256)
+#endif // !defined(MICRO_OS_PLUS_INTEGER_INIT_PROFILER_ENTRIES)
+
+// The kinds of the entries.
+#define AARCH64_INIT_PROFILER_KIND_SYSINIT (0)
+#define AARCH64_INIT_PROFILER_KIND_PLATFORM (1)
+#define AARCH64_INIT_PROFILER_KIND_PREINIT (2)
+#define AARCH64_INIT_PROFILER_KIND_INIT (3)
+#define AARCH64_INIT_PROFILER_KIND_INIT_ARRAY (4)
+#define AARCH64_INIT_PROFILER_KIND_LAZY (5)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  typedef struct aarch64_architecture_init_profiler_entry_s
+  {
+    // The function address.
+    uintptr_t address;
+    // The start, in counter ticks since the profiler run began.
+    uint64_t begin;
+    // The duration, in counter ticks.
+    uint64_t ticks;
+    uint32_t kind;
+  } aarch64_architecture_init_profiler_entry_t;
+
+  // --------------------------------------------------------------------------
+  // Boot time profiler in C.
+
+  /**
+   * Run the preinit functions, `_init()` and the static constructors,
+   * like `__libc_init_array()`, recording each one. To be called
+   * by the startup code instead of `__libc_init_array()`.
+   */
+  void
+  aarch64_architecture_init_profiler_init_array (void);
+
+  /**
+   * Record a function run outside the init arrays, with the counter
+   * values before and after.
+   */
+  void
+  aarch64_architecture_init_profiler_record (uint32_t kind,
+                                             uintptr_t address,
+                                             uint64_t begin, uint64_t end);
+
+  /**
+   * The recorded entries, in the order they ran.
+   */
+  const aarch64_architecture_init_profiler_entry_t*
+  aarch64_architecture_init_profiler_get_entries (void);
+
+  /**
+   * The number of recorded entries.
+   */
+  size_t
+  aarch64_architecture_init_profiler_get_count (void);
+
+  /**
+   * The number of entries that did not fit in the table.
+   */
+  size_t
+  aarch64_architecture_init_profiler_get_dropped_count (void);
+
+  /**
+   * Write the table to a host file, as CSV, with the kind, the address,
+   * the start and the duration, in ticks and, with
+   * MICRO_OS_PLUS_INCLUDE_CLOCK, in ns. Return 0, or -1 on error.
+   */
+  int
+  aarch64_architecture_init_profiler_write (const char* path);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::init_profiler
+{
+  // --------------------------------------------------------------------------
+  // Boot time profiler in C++.
+
+  using entry = aarch64_architecture_init_profiler_entry_t;
+
+  /**
+   * Run the init arrays, recording each function.
+   */
+  void
+  init_array (void);
+
+  /**
+   * The recorded entries.
+   */
+  const entry*
+  entries (void);
+
+  /**
+   * The number of recorded entries.
+   */
+  size_t
+  count (void);
+
+  /**
+   * The number of entries dropped.
+   */
+  size_t
+  dropped (void);
+
+  /**
+   * Write the table to the host, as CSV.
+   */
+  bool
+  write (const char* path = "init-profile.csv");
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::init_profiler
+
+namespace aarch64::architecture::startup
+{
+  // --------------------------------------------------------------------------
+
+  /**
+   * A static object constructed on the first `get()`, not by the
+   * static constructors, to shorten the boot; it is constant
+   * initialised and never destroyed.
+   *
+   * Safe to use from several cores, the others wait for the first
+   * one to complete the construction; the constructor must not use
+   * the object itself.
+   */
+  template <typename T>
+  class lazy
+  {
+  public:
+    constexpr lazy () = default;
+
+    lazy (const lazy&) = delete;
+    lazy&
+    operator= (const lazy&)
+        = delete;
+
+    /**
+     * The object, constructed if needed.
+     */
+    T&
+    get (void);
+
+    T&
+    operator* (void);
+
+    T*
+    operator->(void);
+
+    /**
+     * True if already constructed.
+     */
+    bool
+    is_constructed (void) const;
+
+  protected:
+    static constexpr uint32_t state_none = 0;
+    static constexpr uint32_t state_constructing = 1;
+    static constexpr uint32_t state_constructed = 2;
+
+    static void
+    construct (void* storage);
+
+    void
+    construct_slow (void);
+
+    alignas (T) unsigned char storage_[sizeof (T)]{};
+    // Not volatile, to keep the class a literal type; all accesses
+    // are done with the atomic functions.
+    uint32_t state_ = state_none;
+  };
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::startup
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_INIT_PROFILER_H_
+
+// ----------------------------------------------------------------------------
@@ -68,6 +68,383 @@ extern "C"
     );
   }
 
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_wfe (void)
+  {
+    __asm__ volatile(
+
+        " wfe "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_sev (void)
+  {
+    __asm__ volatile(
+
+        " sev "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_sevl (void)
+  {
+    __asm__ volatile(
+
+        " sevl "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_clrex (void)
+  {
+    __asm__ volatile(
+
+        " clrex "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_dmb_ish (void)
+  {
+    __asm__ volatile(
+
+        " dmb ish "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_dmb_ishld (void)
+  {
+    __asm__ volatile(
+
+        " dmb ishld "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_dmb_ishst (void)
+  {
+    __asm__ volatile(
+
+        " dmb ishst "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_dmb_sy (void)
+  {
+    __asm__ volatile(
+
+        " dmb sy "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_dmb_ld (void)
+  {
+    __asm__ volatile(
+
+        " dmb ld "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_dmb_st (void)
+  {
+    __asm__ volatile(
+
+        " dmb st "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_dsb_ish (void)
+  {
+    __asm__ volatile(
+
+        " dsb ish "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_dsb_ishld (void)
+  {
+    __asm__ volatile(
+
+        " dsb ishld "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_dsb_ishst (void)
+  {
+    __asm__ volatile(
+
+        " dsb ishst "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_dsb_sy (void)
+  {
+    __asm__ volatile(
+
+        " dsb sy "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_dsb_ld (void)
+  {
+    __asm__ volatile(
+
+        " dsb ld "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_dsb_st (void)
+  {
+    __asm__ volatile(
+
+        " dsb st "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_isb (void)
+  {
+    __asm__ volatile(
+
+        " isb "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  aarch64_architecture_load_acquire_32 (const volatile uint32_t* ptr)
+  {
+    uint32_t result;
+
+    __asm__ volatile(
+
+        " ldar %w[result], %[mem] "
+
+        : [result] "=r"(result) /* Outputs */
+        : [mem] "Q"(*ptr) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+
+    return result;
+  }
+
+  static inline __attribute__ ((always_inline)) uint64_t
+  aarch64_architecture_load_acquire_64 (const volatile uint64_t* ptr)
+  {
+    uint64_t result;
+
+    __asm__ volatile(
+
+        " ldar %[result], %[mem] "
+
+        : [result] "=r"(result) /* Outputs */
+        : [mem] "Q"(*ptr) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+
+    return result;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_store_release_32 (volatile uint32_t* ptr,
+                                         uint32_t value)
+  {
+    __asm__ volatile(
+
+        " stlr %w[value], %[mem] "
+
+        : [mem] "=Q"(*ptr) /* Outputs */
+        : [value] "r"(value) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_store_release_64 (volatile uint64_t* ptr,
+                                         uint64_t value)
+  {
+    __asm__ volatile(
+
+        " stlr %[value], %[mem] "
+
+        : [mem] "=Q"(*ptr) /* Outputs */
+        : [value] "r"(value) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  aarch64_architecture_load_exclusive_acquire_32 (
+      const volatile uint32_t* ptr)
+  {
+    uint32_t result;
+
+    __asm__ volatile(
+
+        " ldaxr %w[result], %[mem] "
+
+        : [result] "=r"(result) /* Outputs */
+        : [mem] "Q"(*ptr) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+
+    return result;
+  }
+
+  static inline __attribute__ ((always_inline)) uint64_t
+  aarch64_architecture_load_exclusive_acquire_64 (
+      const volatile uint64_t* ptr)
+  {
+    uint64_t result;
+
+    __asm__ volatile(
+
+        " ldaxr %[result], %[mem] "
+
+        : [result] "=r"(result) /* Outputs */
+        : [mem] "Q"(*ptr) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+
+    return result;
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  aarch64_architecture_wait_while_equal_32 (const volatile uint32_t* ptr,
+                                            uint32_t value)
+  {
+    uint32_t result;
+
+    // `sevl` makes the first `wfe` fall through; each `ldaxr` arms the
+    // monitor, which is cleared, with an event, by a store to the
+    // same granule.
+    __asm__ volatile(
+
+        " sevl \n"
+        "1: \n"
+        " wfe \n"
+        " ldaxr %w[result], %[mem] \n"
+        " cmp %w[result], %w[value] \n"
+        " b.eq 1b \n"
+        " clrex \n"
+
+        : [result] "=&r"(result) /* Outputs */
+        : [mem] "Q"(*ptr), [value] "r"(value) /* Inputs */
+        : "cc", "memory" /* Clobbers */
+    );
+
+    return result;
+  }
+
+  static inline __attribute__ ((always_inline)) uint64_t
+  aarch64_architecture_wait_while_equal_64 (const volatile uint64_t* ptr,
+                                            uint64_t value)
+  {
+    uint64_t result;
+
+    // `sevl` makes the first `wfe` fall through; each `ldaxr` arms the
+    // monitor, which is cleared, with an event, by a store to the
+    // same granule.
+    __asm__ volatile(
+
+        " sevl \n"
+        "1: \n"
+        " wfe \n"
+        " ldaxr %[result], %[mem] \n"
+        " cmp %[result], %[value] \n"
+        " b.eq 1b \n"
+        " clrex \n"
+
+        : [result] "=&r"(result) /* Outputs */
+        : [mem] "Q"(*ptr), [value] "r"(value) /* Inputs */
+        : "cc", "memory" /* Clobbers */
+    );
+
+    return result;
+  }
+
   static inline __attribute__ ((always_inline)) void
   micro_os_plus_architecture_nop (void)
   {
@@ -124,6 +501,191 @@ namespace aarch64::architecture
     aarch64_architecture_wfi ();
   }
 
+  inline __attribute__ ((always_inline)) void
+  wfe (void)
+  {
+    aarch64_architecture_wfe ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  sev (void)
+  {
+    aarch64_architecture_sev ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  sevl (void)
+  {
+    aarch64_architecture_sevl ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  clrex (void)
+  {
+    aarch64_architecture_clrex ();
+  }
+
+  // --------------------------------------------------------------------------
+
+  template <barrier_type T, barrier_domain D>
+  inline __attribute__ ((always_inline)) void
+  dmb (void)
+  {
+    if constexpr (D == barrier_domain::system)
+      {
+        if constexpr (T == barrier_type::loads)
+          {
+            aarch64_architecture_dmb_ld ();
+          }
+        else if constexpr (T == barrier_type::stores)
+          {
+            aarch64_architecture_dmb_st ();
+          }
+        else
+          {
+            aarch64_architecture_dmb_sy ();
+          }
+      }
+    else
+      {
+        if constexpr (T == barrier_type::loads)
+          {
+            aarch64_architecture_dmb_ishld ();
+          }
+        else if constexpr (T == barrier_type::stores)
+          {
+            aarch64_architecture_dmb_ishst ();
+          }
+        else
+          {
+            aarch64_architecture_dmb_ish ();
+          }
+      }
+  }
+
+  template <barrier_type T, barrier_domain D>
+  inline __attribute__ ((always_inline)) void
+  dsb (void)
+  {
+    if constexpr (D == barrier_domain::system)
+      {
+        if constexpr (T == barrier_type::loads)
+          {
+            aarch64_architecture_dsb_ld ();
+          }
+        else if constexpr (T == barrier_type::stores)
+          {
+            aarch64_architecture_dsb_st ();
+          }
+        else
+          {
+            aarch64_architecture_dsb_sy ();
+          }
+      }
+    else
+      {
+        if constexpr (T == barrier_type::loads)
+          {
+            aarch64_architecture_dsb_ishld ();
+          }
+        else if constexpr (T == barrier_type::stores)
+          {
+            aarch64_architecture_dsb_ishst ();
+          }
+        else
+          {
+            aarch64_architecture_dsb_ish ();
+          }
+      }
+  }
+
+  inline __attribute__ ((always_inline)) void
+  isb (void)
+  {
+    aarch64_architecture_isb ();
+  }
+
+  // --------------------------------------------------------------------------
+
+  template <typename T>
+  inline __attribute__ ((always_inline)) T
+  load_acquire (const volatile T* ptr)
+  {
+    static_assert (sizeof (T) == 4 || sizeof (T) == 8,
+                   "Only 32 and 64-bit objects are supported");
+
+    if constexpr (sizeof (T) == 4)
+      {
+        return static_cast<T> (aarch64_architecture_load_acquire_32 (
+            reinterpret_cast<const volatile uint32_t*> (ptr)));
+      }
+    else
+      {
+        return static_cast<T> (aarch64_architecture_load_acquire_64 (
+            reinterpret_cast<const volatile uint64_t*> (ptr)));
+      }
+  }
+
+  template <typename T>
+  inline __attribute__ ((always_inline)) void
+  store_release (volatile T* ptr, T value)
+  {
+    static_assert (sizeof (T) == 4 || sizeof (T) == 8,
+                   "Only 32 and 64-bit objects are supported");
+
+    if constexpr (sizeof (T) == 4)
+      {
+        aarch64_architecture_store_release_32 (
+            reinterpret_cast<volatile uint32_t*> (ptr),
+            static_cast<uint32_t> (value));
+      }
+    else
+      {
+        aarch64_architecture_store_release_64 (
+            reinterpret_cast<volatile uint64_t*> (ptr),
+            static_cast<uint64_t> (value));
+      }
+  }
+
+  template <typename T, typename P>
+  inline T
+  wait_until (const volatile T* ptr, P pred)
+  {
+    static_assert (sizeof (T) == 4 || sizeof (T) == 8,
+                   "Only 32 and 64-bit objects are supported");
+
+    // The fast path, no need to arm the monitor.
+    T value = load_acquire (ptr);
+    if (pred (value))
+      {
+        return value;
+      }
+
+    for (;;)
+      {
+        // Arm the monitor before checking, so a store between the
+        // check and the `wfe` is not lost.
+        if constexpr (sizeof (T) == 4)
+          {
+            value = static_cast<T> (
+                aarch64_architecture_load_exclusive_acquire_32 (
+                    reinterpret_cast<const volatile uint32_t*> (ptr)));
+          }
+        else
+          {
+            value = static_cast<T> (
+                aarch64_architecture_load_exclusive_acquire_64 (
+                    reinterpret_cast<const volatile uint64_t*> (ptr)));
+          }
+        if (pred (value))
+          {
+            aarch64_architecture_clrex ();
+            return value;
+          }
+        aarch64_architecture_wfe ();
+      }
+  }
+
   // --------------------------------------------------------------------------
 } // namespace aarch64::architecture
 
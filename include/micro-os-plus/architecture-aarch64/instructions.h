@@ -48,6 +48,169 @@ extern "C"
   static void
   aarch64_architecture_wfi (void);
 
+  /**
+   * `wfe` instruction; sleep until an event, like a `sev` from another
+   * core or the clearing of the local exclusive monitor.
+   */
+  static void
+  aarch64_architecture_wfe (void);
+
+  /**
+   * `sev` instruction; signal an event to all cores.
+   */
+  static void
+  aarch64_architecture_sev (void);
+
+  /**
+   * `sevl` instruction; signal an event to the local core only,
+   * so the next `wfe` does not sleep.
+   */
+  static void
+  aarch64_architecture_sevl (void);
+
+  /**
+   * `clrex` instruction; clear the local exclusive monitor.
+   */
+  static void
+  aarch64_architecture_clrex (void);
+
+  // --------------------------------------------------------------------------
+  // Barriers in C.
+  //
+  // Prefer the Inner Shareable variants for ordering memory accesses
+  // between cores; the full system ones are needed only for devices
+  // and for non-coherent masters.
+
+  /**
+   * `dmb ish`; order all accesses, in the Inner Shareable domain.
+   */
+  static void
+  aarch64_architecture_dmb_ish (void);
+
+  /**
+   * `dmb ishld`; order the loads before the later loads and stores.
+   */
+  static void
+  aarch64_architecture_dmb_ishld (void);
+
+  /**
+   * `dmb ishst`; order the stores before the later stores.
+   */
+  static void
+  aarch64_architecture_dmb_ishst (void);
+
+  /**
+   * `dmb sy`; order all accesses, in the full system.
+   */
+  static void
+  aarch64_architecture_dmb_sy (void);
+
+  /**
+   * `dmb ld`; order the loads, in the full system.
+   */
+  static void
+  aarch64_architecture_dmb_ld (void);
+
+  /**
+   * `dmb st`; order the stores, in the full system.
+   */
+  static void
+  aarch64_architecture_dmb_st (void);
+
+  /**
+   * `dsb ish`; wait for all accesses to complete, in the Inner
+   * Shareable domain (for example after TLB or cache maintenance).
+   */
+  static void
+  aarch64_architecture_dsb_ish (void);
+
+  /**
+   * `dsb ishld`; wait for the loads to complete, in the Inner
+   * Shareable domain.
+   */
+  static void
+  aarch64_architecture_dsb_ishld (void);
+
+  /**
+   * `dsb ishst`; wait for the stores to complete, in the Inner
+   * Shareable domain.
+   */
+  static void
+  aarch64_architecture_dsb_ishst (void);
+
+  /**
+   * `dsb sy`; wait for all accesses to complete, in the full system.
+   */
+  static void
+  aarch64_architecture_dsb_sy (void);
+
+  /**
+   * `dsb ld`; wait for the loads to complete, in the full system.
+   */
+  static void
+  aarch64_architecture_dsb_ld (void);
+
+  /**
+   * `dsb st`; wait for the stores to complete, in the full system.
+   */
+  static void
+  aarch64_architecture_dsb_st (void);
+
+  /**
+   * `isb`; flush the pipeline, so that later instructions see the
+   * effect of the previous system register writes.
+   */
+  static void
+  aarch64_architecture_isb (void);
+
+  // --------------------------------------------------------------------------
+  // Load-acquire/store-release in C.
+
+  /**
+   * `ldar`; no later access is performed before this load.
+   */
+  static uint32_t
+  aarch64_architecture_load_acquire_32 (const volatile uint32_t* ptr);
+
+  static uint64_t
+  aarch64_architecture_load_acquire_64 (const volatile uint64_t* ptr);
+
+  /**
+   * `stlr`; all previous accesses are performed before this store.
+   */
+  static void
+  aarch64_architecture_store_release_32 (volatile uint32_t* ptr,
+                                         uint32_t value);
+
+  static void
+  aarch64_architecture_store_release_64 (volatile uint64_t* ptr,
+                                         uint64_t value);
+
+  /**
+   * `ldaxr`; load-acquire and arm the exclusive monitor, so that a
+   * later store by another core to the same granule wakes a `wfe`.
+   */
+  static uint32_t
+  aarch64_architecture_load_exclusive_acquire_32 (
+      const volatile uint32_t* ptr);
+
+  static uint64_t
+  aarch64_architecture_load_exclusive_acquire_64 (
+      const volatile uint64_t* ptr);
+
+  /**
+   * Sleep in `wfe` while the value at `ptr` is equal to `value`;
+   * return the new value, read with acquire semantics.
+   * The writer needs no `sev`, a plain store wakes the waiters.
+   */
+  static uint32_t
+  aarch64_architecture_wait_while_equal_32 (const volatile uint32_t* ptr,
+                                            uint32_t value);
+
+  static uint64_t
+  aarch64_architecture_wait_while_equal_64 (const volatile uint64_t* ptr,
+                                            uint64_t value);
+
   // --------------------------------------------------------------------------
   // Portable architecture assembly instructions in C.
 
@@ -102,6 +265,101 @@ namespace aarch64::architecture
   void
   wfi (void);
 
+  /**
+   * The assembler `wfe` instruction.
+   */
+  void
+  wfe (void);
+
+  /**
+   * The assembler `sev` instruction.
+   */
+  void
+  sev (void);
+
+  /**
+   * The assembler `sevl` instruction.
+   */
+  void
+  sevl (void);
+
+  /**
+   * The assembler `clrex` instruction.
+   */
+  void
+  clrex (void);
+
+  // --------------------------------------------------------------------------
+  // Barriers in C++.
+
+  /**
+   * The shareability domain of a barrier.
+   */
+  enum class barrier_domain
+  {
+    inner_shareable,
+    system,
+  };
+
+  /**
+   * The accesses ordered by a barrier.
+   */
+  enum class barrier_type
+  {
+    all, // Loads and stores.
+    loads, // Loads, before later loads and stores.
+    stores, // Stores, before later stores.
+  };
+
+  /**
+   * `dmb`, by default `dmb ish`.
+   */
+  template <barrier_type T = barrier_type::all,
+            barrier_domain D = barrier_domain::inner_shareable>
+  void
+  dmb (void);
+
+  /**
+   * `dsb`, by default `dsb ish`.
+   */
+  template <barrier_type T = barrier_type::all,
+            barrier_domain D = barrier_domain::inner_shareable>
+  void
+  dsb (void);
+
+  /**
+   * The assembler `isb` instruction.
+   */
+  void
+  isb (void);
+
+  // --------------------------------------------------------------------------
+  // Load-acquire/store-release in C++.
+
+  /**
+   * `ldar`, for 32 and 64-bit objects.
+   */
+  template <typename T>
+  T
+  load_acquire (const volatile T* ptr);
+
+  /**
+   * `stlr`, for 32 and 64-bit objects.
+   */
+  template <typename T>
+  void
+  store_release (volatile T* ptr, T value);
+
+  /**
+   * Sleep in `wfe` until `pred(*ptr)` is true, and return that value;
+   * a futex-like wait, the writer only needs to store to `ptr`,
+   * or to issue `sev`. The predicate must be cheap and without side
+   * effects, it is evaluated on each wake-up.
+   */
+  template <typename T, typename P>
+  T
+  wait_until (const volatile T* ptr, P pred);
+
   // --------------------------------------------------------------------------
 } // namespace aarch64::architecture
 
@@ -0,0 +1,157 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_MEMORY_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_MEMORY_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/memory.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+#include <cstddef>
+#include <new>
+#include <utility>
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the AArch64 memory pools and arenas.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+  // Memory arenas in C.
+
+  static inline __attribute__ ((always_inline)) void*
+  aarch64_architecture_memory_arena_allocate (
+      aarch64_architecture_memory_arena_t* arena, size_t size)
+  {
+    uintptr_t begin = arena->current;
+    // Also rounds up the size, so the next block starts on a new line.
+    uintptr_t end
+        = (begin + size + arena->alignment - 1) & ~(arena->alignment - 1);
+    if (end > arena->end || end < begin)
+      {
+        return (void*)0;
+      }
+
+    arena->current = end;
+    return (void*)begin;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_memory_arena_reset (
+      aarch64_architecture_memory_arena_t* arena)
+  {
+    arena->current = arena->begin;
+  }
+
+  static inline __attribute__ ((always_inline)) size_t
+  aarch64_architecture_memory_arena_get_used (
+      const aarch64_architecture_memory_arena_t* arena)
+  {
+    return (size_t)(arena->current - arena->begin);
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::memory
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) bool
+  initialize_heap (size_t size)
+  {
+    return aarch64_architecture_memory_initialize_heap (size) == 0;
+  }
+
+  inline __attribute__ ((always_inline)) size_t
+  line_size (void)
+  {
+    return aarch64_architecture_memory_get_line_size ();
+  }
+
+  inline __attribute__ ((always_inline)) void*
+  allocate (size_t size)
+  {
+    return aarch64_architecture_memory_allocate (size);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  deallocate (void* block)
+  {
+    aarch64_architecture_memory_free (block);
+  }
+
+  inline __attribute__ ((always_inline)) bool
+  arena::initialize (size_t size)
+  {
+    return aarch64_architecture_memory_arena_initialize (&arena_, size) == 0;
+  }
+
+  inline __attribute__ ((always_inline)) void*
+  arena::allocate (size_t size)
+  {
+    return aarch64_architecture_memory_arena_allocate (&arena_, size);
+  }
+
+  template <typename T, typename... Args>
+  inline __attribute__ ((always_inline)) T*
+  arena::make (Args&&... args)
+  {
+    // The cache lines are at least 16 bytes.
+    static_assert (alignof (T) <= alignof (std::max_align_t));
+
+    void* storage = allocate (sizeof (T));
+    if (storage == nullptr)
+      {
+        return nullptr;
+      }
+    return new (storage) T (std::forward<Args> (args)...);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  arena::reset (void)
+  {
+    aarch64_architecture_memory_arena_reset (&arena_);
+  }
+
+  inline __attribute__ ((always_inline)) size_t
+  arena::used (void) const
+  {
+    return aarch64_architecture_memory_arena_get_used (&arena_);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::memory
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_MEMORY_INLINES_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,247 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_MEMORY_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_MEMORY_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/defines.h>
+#include <micro-os-plus/architecture-aarch64/types.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Declarations of the AArch64 memory pools and arenas.
+//
+// A region of RAM, usually taken from the heap between `__end__` and
+// the stacks with `sbrk()`, so newlib malloc() can still be used, is
+// divided without locks between:
+//
+// - the pools, with blocks of fixed sizes (the cache line size, read
+//   from CTR_EL0, times a power of 2); each core has its own free
+//   lists, so allocation and deallocation are O(1) and take no lock;
+//   blocks freed by other cores are pushed to a separate list, with
+//   an atomic compare-and-swap, and taken back by the owner all at
+//   once, on its next allocation of that size;
+// - the arenas, with bump pointer allocation and bulk reset, owned by
+//   a single core or thread.
+//
+// The pools take memory from the top of the region, in spans of
+// MICRO_OS_PLUS_INTEGER_MEMORY_SPAN_SIZE bytes, which are never returned;
+// the first cache line of each span records the owner core and the
+// size, so the deallocation needs no block header. The arenas take
+// memory from the bottom.
+//
+// All blocks are aligned to the cache line size, and sized in multiples
+// of it, so two blocks never share a line. The free lists are safe to
+// use from the interrupt handlers, the interrupts are masked while
+// the local lists are updated.
+
+// The number of pool sizes: the cache line size, 2 times, 4 times...
+#if !defined(MICRO_OS_PLUS_INTEGER_MEMORY_SIZE_CLASSES)
+#define MICRO_OS_PLUS_INTEGER_MEMORY_SIZE_CLASSES (7)
+#endif // !defined(MICRO_OS_PLUS_INTEGER_MEMORY_SIZE_CLASSES)
+
+// The unit in which the pools take memory from the region; a power
+// of 2, at least 4 times the largest block.
+#if !defined(MICRO_OS_PLUS_INTEGER_MEMORY_SPAN_SIZE)
+#define MICRO_OS_PLUS_INTEGER_MEMORY_SPAN_SIZE (16 * 1024)
+#endif // !defined(MICRO_OS_PLUS_INTEGER_MEMORY_SPAN_SIZE)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  /**
+   * A bump pointer arena; not safe to share between cores.
+   */
+  typedef struct aarch64_architecture_memory_arena_s
+  {
+    uintptr_t begin;
+    uintptr_t current;
+    uintptr_t end;
+    uintptr_t alignment;
+  } aarch64_architecture_memory_arena_t;
+
+  // --------------------------------------------------------------------------
+  // Memory pools and arenas in C.
+
+  /**
+   * Use the given region for the pools and the arenas. To be called
+   * once, before the other cores start. Return 0, or -1 if the region
+   * is too small for one span.
+   */
+  int
+  aarch64_architecture_memory_initialize (void* begin, size_t size);
+
+  /**
+   * Take `size` bytes from the heap, with `sbrk()`, and use them for
+   * the pools and the arenas. Return 0, or -1 if the heap is too small.
+   */
+  int
+  aarch64_architecture_memory_initialize_heap (size_t size);
+
+  /**
+   * The alignment of all blocks, the data cache line size.
+   */
+  size_t
+  aarch64_architecture_memory_get_line_size (void);
+
+  /**
+   * The largest size served by the pools.
+   */
+  size_t
+  aarch64_architecture_memory_get_max_block_size (void);
+
+  /**
+   * The bytes of the region not yet taken by pools or arenas.
+   */
+  size_t
+  aarch64_architecture_memory_get_free (void);
+
+  /**
+   * Allocate a block from the current core pool; the size is rounded
+   * up to the block sizes. Return NULL if the size is too large or if
+   * there is no more memory.
+   */
+  void*
+  aarch64_architecture_memory_allocate (size_t size);
+
+  /**
+   * Return a block to the pool of the core that allocated it; may be
+   * called from any core. NULL is ignored.
+   */
+  void
+  aarch64_architecture_memory_free (void* block);
+
+  /**
+   * Take `size` bytes from the region for an arena. Return 0, or -1
+   * if there is not enough memory.
+   */
+  int
+  aarch64_architecture_memory_arena_initialize (
+      aarch64_architecture_memory_arena_t* arena, size_t size);
+
+  /**
+   * Allocate from the arena, aligned to the cache line size. Return
+   * NULL if the arena is full.
+   */
+  static void*
+  aarch64_architecture_memory_arena_allocate (
+      aarch64_architecture_memory_arena_t* arena, size_t size);
+
+  /**
+   * Release all the allocations at once.
+   */
+  static void
+  aarch64_architecture_memory_arena_reset (
+      aarch64_architecture_memory_arena_t* arena);
+
+  /**
+   * The bytes allocated since the last reset.
+   */
+  static size_t
+  aarch64_architecture_memory_arena_get_used (
+      const aarch64_architecture_memory_arena_t* arena);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::memory
+{
+  // --------------------------------------------------------------------------
+  // Memory pools and arenas in C++.
+
+  /**
+   * Use `size` bytes of the heap for the pools and the arenas.
+   */
+  bool
+  initialize_heap (size_t size);
+
+  /**
+   * The alignment of all blocks.
+   */
+  size_t
+  line_size (void);
+
+  /**
+   * Allocate a block from the current core pool, or nullptr.
+   */
+  void*
+  allocate (size_t size);
+
+  /**
+   * Return a block to its pool, from any core.
+   */
+  void
+  deallocate (void* block);
+
+  /**
+   * A bump pointer arena, with bulk reset; the objects constructed
+   * in it are not destroyed.
+   */
+  class arena
+  {
+  public:
+    arena () = default;
+
+    arena (const arena&) = delete;
+    arena&
+    operator= (const arena&)
+        = delete;
+
+    /**
+     * Take the memory from the region.
+     */
+    bool
+    initialize (size_t size);
+
+    void*
+    allocate (size_t size);
+
+    /**
+     * Construct an object in the arena, or return nullptr.
+     */
+    template <typename T, typename... Args>
+    T*
+    make (Args&&... args);
+
+    void
+    reset (void);
+
+    size_t
+    used (void) const;
+
+  protected:
+    aarch64_architecture_memory_arena_t arena_{};
+  };
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::memory
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_MEMORY_H_
+
+// ----------------------------------------------------------------------------
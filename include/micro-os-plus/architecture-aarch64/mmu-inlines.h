@@ -0,0 +1,161 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_MMU_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_MMU_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/mmu.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the AArch64 EL1 MMU support.
+
+// SCTLR_EL1 fields.
+#define AARCH64_SCTLR_M (1ULL << 0)
+#define AARCH64_SCTLR_A (1ULL << 1)
+#define AARCH64_SCTLR_C (1ULL << 2)
+#define AARCH64_SCTLR_I (1ULL << 12)
+#define AARCH64_SCTLR_WXN (1ULL << 19)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) aarch64_architecture_register_t
+  aarch64_architecture_get_sctlr (void)
+  {
+    aarch64_architecture_register_t result;
+
+    __asm__ volatile(
+
+        " mrs %[result], sctlr_el1 "
+
+        : [result] "=r"(result) /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+
+    return result;
+  }
+
+  static inline __attribute__ ((always_inline)) bool
+  aarch64_architecture_mmu_is_enabled (void)
+  {
+    return (aarch64_architecture_get_sctlr () & AARCH64_SCTLR_M) != 0;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_tlb_invalidate_all (void)
+  {
+    __asm__ volatile(
+
+        " dsb ishst \n"
+        " tlbi vmalle1 \n"
+        " dsb nsh \n"
+        " isb \n"
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::mmu
+{
+  // --------------------------------------------------------------------------
+
+  template <memory_type M, access A>
+  constexpr uint64_t
+  attributes (void)
+  {
+    static_assert (M == memory_type::device ? A == access::read_write : true,
+                   "Device memory must be read-write, never executable");
+
+    uint64_t value
+        = AARCH64_MMU_ATTR_INDEX (static_cast<uint8_t> (M)) | AARCH64_MMU_AF;
+
+    if constexpr (M != memory_type::device)
+      {
+        value |= AARCH64_MMU_SH_INNER;
+      }
+
+    constexpr bool user = A == access::user_read_execute
+                          || A == access::user_read_only
+                          || A == access::user_read_write;
+    if constexpr (user)
+      {
+        value |= AARCH64_MMU_AP_EL0;
+      }
+
+    if constexpr (A != access::read_write && A != access::user_read_write)
+      {
+        value |= AARCH64_MMU_AP_READ_ONLY;
+      }
+
+    // The EL1 code is executable only at EL1, the EL0 code only at EL0.
+    if constexpr (A != access::user_read_execute)
+      {
+        value |= AARCH64_MMU_UXN;
+      }
+    if constexpr (A != access::read_execute)
+      {
+        value |= AARCH64_MMU_PXN;
+      }
+
+    return value;
+  }
+
+  inline __attribute__ ((always_inline)) bool
+  map (uintptr_t begin, uintptr_t end, uint64_t attributes)
+  {
+    return aarch64_architecture_mmu_map (begin, end, attributes);
+  }
+
+  inline __attribute__ ((always_inline)) bool
+  protect (uintptr_t begin, uintptr_t end, uint64_t attributes)
+  {
+    return aarch64_architecture_mmu_protect (begin, end, attributes);
+  }
+
+  inline __attribute__ ((always_inline)) bool
+  is_enabled (void)
+  {
+    return aarch64_architecture_mmu_is_enabled ();
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::mmu
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_MMU_INLINES_H_
+
+// ----------------------------------------------------------------------------
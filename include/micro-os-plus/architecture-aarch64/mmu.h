@@ -0,0 +1,256 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_MMU_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_MMU_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/defines.h>
+#include <micro-os-plus/architecture-aarch64/types.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Declarations of the AArch64 EL1 MMU support.
+//
+// The translation regime is EL1&0, with a 4 KB granule and a 39-bit
+// identity mapped address space, translated by TTBR0_EL1 starting at
+// level 1. Ranges are mapped with the largest blocks allowed by their
+// alignment (1 GB, 2 MB), and 4 KB pages only at the unaligned ends.
+//
+// The tables are allocated from a static pool in `.noinit`, since they
+// are built before the `.bss` section is cleared.
+
+// The number of 4 KB translation tables in the pool, including the
+// level 1 table.
+#if !defined(MICRO_OS_PLUS_INTEGER_MMU_TABLES)
+#define MICRO_OS_PLUS_INTEGER_MMU_TABLES (8)
+#endif
+
+// The peripherals range mapped by default as Device-nGnRE
+// (the QEMU virt peripherals, below the RAM).
+#if !defined(MICRO_OS_PLUS_INTEGER_MMU_DEVICE_BEGIN)
+#define MICRO_OS_PLUS_INTEGER_MMU_DEVICE_BEGIN (0x00000000ULL)
+#endif
+
+#if !defined(MICRO_OS_PLUS_INTEGER_MMU_DEVICE_END)
+#define MICRO_OS_PLUS_INTEGER_MMU_DEVICE_END (0x40000000ULL)
+#endif
+
+// MAIR_EL1 attribute indices, as programmed by the MMU initialisation.
+#define AARCH64_MMU_MAIR_DEVICE_NGNRE (0)
+#define AARCH64_MMU_MAIR_NORMAL_WB (1)
+#define AARCH64_MMU_MAIR_NORMAL_NC (2)
+
+#define AARCH64_MMU_MAIR_VALUE                                                \
+  ((0x04ULL << (8 * AARCH64_MMU_MAIR_DEVICE_NGNRE))                           \
+   | (0xFFULL << (8 * AARCH64_MMU_MAIR_NORMAL_WB))                            \
+   | (0x44ULL << (8 * AARCH64_MMU_MAIR_NORMAL_NC)))
+
+// Block and page descriptors attribute fields.
+#define AARCH64_MMU_ATTR_INDEX(index) ((uint64_t)(index) << 2)
+#define AARCH64_MMU_AP_EL0 (1ULL << 6)
+#define AARCH64_MMU_AP_READ_ONLY (1ULL << 7)
+#define AARCH64_MMU_SH_INNER (3ULL << 8)
+#define AARCH64_MMU_AF (1ULL << 10)
+#define AARCH64_MMU_PXN (1ULL << 53)
+#define AARCH64_MMU_UXN (1ULL << 54)
+
+// Ready to use attributes for aarch64_architecture_mmu_map().
+#define AARCH64_MMU_ATTRIBUTES_CODE                                           \
+  (AARCH64_MMU_ATTR_INDEX (AARCH64_MMU_MAIR_NORMAL_WB) | AARCH64_MMU_SH_INNER \
+   | AARCH64_MMU_AF | AARCH64_MMU_AP_READ_ONLY | AARCH64_MMU_UXN)
+
+#define AARCH64_MMU_ATTRIBUTES_RODATA                                         \
+  (AARCH64_MMU_ATTR_INDEX (AARCH64_MMU_MAIR_NORMAL_WB) | AARCH64_MMU_SH_INNER \
+   | AARCH64_MMU_AF | AARCH64_MMU_AP_READ_ONLY | AARCH64_MMU_PXN              \
+   | AARCH64_MMU_UXN)
+
+#define AARCH64_MMU_ATTRIBUTES_DATA                                           \
+  (AARCH64_MMU_ATTR_INDEX (AARCH64_MMU_MAIR_NORMAL_WB) | AARCH64_MMU_SH_INNER \
+   | AARCH64_MMU_AF | AARCH64_MMU_PXN | AARCH64_MMU_UXN)
+
+// Accessible at EL0 too; the EL0 code is not executable at EL1.
+#define AARCH64_MMU_ATTRIBUTES_USER_CODE                                      \
+  (AARCH64_MMU_ATTR_INDEX (AARCH64_MMU_MAIR_NORMAL_WB) | AARCH64_MMU_SH_INNER \
+   | AARCH64_MMU_AF | AARCH64_MMU_AP_EL0 | AARCH64_MMU_AP_READ_ONLY           \
+   | AARCH64_MMU_PXN)
+
+#define AARCH64_MMU_ATTRIBUTES_USER_DATA                                      \
+  (AARCH64_MMU_ATTR_INDEX (AARCH64_MMU_MAIR_NORMAL_WB) | AARCH64_MMU_SH_INNER \
+   | AARCH64_MMU_AF | AARCH64_MMU_AP_EL0 | AARCH64_MMU_PXN | AARCH64_MMU_UXN)
+
+#define AARCH64_MMU_ATTRIBUTES_DEVICE                                         \
+  (AARCH64_MMU_ATTR_INDEX (AARCH64_MMU_MAIR_DEVICE_NGNRE) | AARCH64_MMU_AF    \
+   | AARCH64_MMU_PXN | AARCH64_MMU_UXN)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+  // MMU support in C.
+
+  /**
+   * System Control Register getter (SCTLR_EL1).
+   */
+  static aarch64_architecture_register_t
+  aarch64_architecture_get_sctlr (void);
+
+  /**
+   * Check if the EL1&0 stage 1 translation is enabled (SCTLR_EL1.M).
+   */
+  static bool
+  aarch64_architecture_mmu_is_enabled (void);
+
+  /**
+   * Invalidate all EL1&0 TLB entries on the current core.
+   */
+  static void
+  aarch64_architecture_tlb_invalidate_all (void);
+
+  /**
+   * Build the default identity map from the linker script symbols,
+   * call aarch64_architecture_mmu_map_devices() and enable
+   * the MMU and the caches.
+   *
+   * Must be called by the startup code at EL1, before the `.data`
+   * and `.bss` sections are initialised (for example from
+   * `micro_os_plus_startup_initialize_hardware_early()`).
+   * A separate `.fast_text` (`sections-flash.ld`) is mapped writable,
+   * for its copy from flash, until
+   * aarch64_architecture_mmu_protect_fast_text().
+   * It must not be called when the MMU is already enabled.
+   */
+  void
+  aarch64_architecture_mmu_initialize (void);
+
+  /**
+   * Identity map the [begin, end) range, rounded to 4 KB pages,
+   * with the given block/page attributes. Return false if the tables
+   * pool is exhausted. Only valid before aarch64_architecture_mmu_enable().
+   */
+  bool
+  aarch64_architecture_mmu_map (uintptr_t begin, uintptr_t end,
+                                uint64_t attributes);
+
+  /**
+   * Change the attributes of an already mapped range, keeping its
+   * blocks and pages, and invalidate the TLB. Return false if part of
+   * the range is not mapped, or is in a larger block.
+   */
+  bool
+  aarch64_architecture_mmu_protect (uintptr_t begin, uintptr_t end,
+                                    uint64_t attributes);
+
+  /**
+   * Map a separate `.fast_text` as read-only and executable, after
+   * it was copied; called by aarch64_architecture_startup_initialize_memory().
+   * Does nothing if the MMU is not enabled.
+   */
+  void
+  aarch64_architecture_mmu_protect_fast_text (void);
+
+  /**
+   * Program MAIR/TCR/TTBR0 and enable the MMU and the caches.
+   */
+  void
+  aarch64_architecture_mmu_enable (void);
+
+  /**
+   * Map the peripherals; called by aarch64_architecture_mmu_initialize().
+   * The default maps MICRO_OS_PLUS_INTEGER_MMU_DEVICE_BEGIN/END;
+   * the application can redefine it.
+   */
+  void
+  aarch64_architecture_mmu_map_devices (void);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::mmu
+{
+  // --------------------------------------------------------------------------
+  // MMU support in C++.
+
+  /**
+   * Memory types, as indices in MAIR_EL1.
+   */
+  enum class memory_type : uint8_t
+  {
+    device = AARCH64_MMU_MAIR_DEVICE_NGNRE,
+    normal = AARCH64_MMU_MAIR_NORMAL_WB,
+    normal_non_cacheable = AARCH64_MMU_MAIR_NORMAL_NC
+  };
+
+  /**
+   * Access permissions. The first ones are for EL1 only; the `user_`
+   * ones also allow EL0 the same access, and only EL0 can execute
+   * `user_read_execute`.
+   */
+  enum class access : uint8_t
+  {
+    read_execute,
+    read_only,
+    read_write,
+    user_read_execute,
+    user_read_only,
+    user_read_write
+  };
+
+  /**
+   * Block/page descriptor attributes for a memory type and access,
+   * computed at compile time.
+   */
+  template <memory_type M, access A>
+  constexpr uint64_t
+  attributes (void);
+
+  /**
+   * Identity map a range; return false if out of tables.
+   */
+  bool
+  map (uintptr_t begin, uintptr_t end, uint64_t attributes);
+
+  /**
+   * Change the attributes of a mapped range; return false if not
+   * possible without splitting blocks.
+   */
+  bool
+  protect (uintptr_t begin, uintptr_t end, uint64_t attributes);
+
+  /**
+   * Check if the MMU is enabled.
+   */
+  bool
+  is_enabled (void);
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::mmu
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_MMU_H_
+
+// ----------------------------------------------------------------------------
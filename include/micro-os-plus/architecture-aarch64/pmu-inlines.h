@@ -0,0 +1,353 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_PMU_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_PMU_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/pmu.h>
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the AArch64 Performance Monitors Unit.
+
+// PMCR_EL0 bits.
+#define AARCH64_PMU_PMCR_E (1U << 0)
+#define AARCH64_PMU_PMCR_P (1U << 1)
+#define AARCH64_PMU_PMCR_C (1U << 2)
+#define AARCH64_PMU_PMCR_LC (1U << 6)
+#define AARCH64_PMU_PMCR_N_SHIFT (11)
+#define AARCH64_PMU_PMCR_N_MASK (0x1FU)
+
+// PMCNTENSET_EL0/PMCNTENCLR_EL0 bit for the cycle counter.
+#define AARCH64_PMU_CYCLE_COUNTER_BIT (1U << 31)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_pmu_enable (void)
+  {
+    uint64_t pmcr;
+
+    __asm__ volatile(
+
+        " mrs %[pmcr], pmcr_el0 "
+
+        : [pmcr] "=r"(pmcr) /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+
+    // Enable, reset all counters, use the 64-bit cycle counter.
+    pmcr |= AARCH64_PMU_PMCR_E | AARCH64_PMU_PMCR_P | AARCH64_PMU_PMCR_C
+            | AARCH64_PMU_PMCR_LC;
+
+    __asm__ volatile(
+
+        " msr pmcr_el0, %[pmcr] \n"
+        // Count cycles at EL0 and EL1.
+        " msr pmccfiltr_el0, xzr \n"
+        " msr pmovsclr_el0, %[all] \n"
+        " msr pmcntenset_el0, %[cycles] \n"
+        " isb \n"
+
+        : /* Outputs */
+        : [pmcr] "r"(pmcr), [all] "r"((uint64_t)0xFFFFFFFFU),
+          [cycles] "r"((uint64_t)AARCH64_PMU_CYCLE_COUNTER_BIT) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_pmu_disable (void)
+  {
+    uint64_t pmcr;
+
+    __asm__ volatile(
+
+        " mrs %[pmcr], pmcr_el0 "
+
+        : [pmcr] "=r"(pmcr) /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+
+    pmcr &= ~(uint64_t)AARCH64_PMU_PMCR_E;
+
+    __asm__ volatile(
+
+        " msr pmcr_el0, %[pmcr] \n"
+        " isb \n"
+
+        : /* Outputs */
+        : [pmcr] "r"(pmcr) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_pmu_enable_user_access (void)
+  {
+    // EN (counters and PMSELR), CR (cycle counter read), ER (event read).
+    __asm__ volatile(
+
+        " msr pmuserenr_el0, %[value] \n"
+        " isb \n"
+
+        : /* Outputs */
+        : [value] "r"((uint64_t)((1U << 0) | (1U << 2) | (1U << 3)))
+        /* Inputs */
+        : /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  aarch64_architecture_pmu_get_event_counters_count (void)
+  {
+    uint64_t pmcr;
+
+    __asm__ volatile(
+
+        " mrs %[pmcr], pmcr_el0 "
+
+        : [pmcr] "=r"(pmcr) /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+
+    return (uint32_t)((pmcr >> AARCH64_PMU_PMCR_N_SHIFT)
+                      & AARCH64_PMU_PMCR_N_MASK);
+  }
+
+  static inline __attribute__ ((always_inline)) uint64_t
+  aarch64_architecture_pmu_get_cycle_counter (void)
+  {
+    uint64_t result;
+
+    __asm__ volatile(
+
+        " mrs %[result], pmccntr_el0 "
+
+        : [result] "=r"(result) /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+
+    return result;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_pmu_set_cycle_counter (uint64_t value)
+  {
+    __asm__ volatile(
+
+        " msr pmccntr_el0, %[value] "
+
+        : /* Outputs */
+        : [value] "r"(value) /* Inputs */
+        : /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_pmu_configure_event_counter (uint32_t counter,
+                                                    uint32_t event)
+  {
+    // The filter bits are left zero, i.e. count at EL0 and EL1.
+    __asm__ volatile(
+
+        " msr pmcntenclr_el0, %[mask] \n"
+        " msr pmselr_el0, %[counter] \n"
+        " isb \n"
+        " msr pmxevtyper_el0, %[event] \n"
+        " msr pmxevcntr_el0, xzr \n"
+        " msr pmovsclr_el0, %[mask] \n"
+        " msr pmcntenset_el0, %[mask] \n"
+        " isb \n"
+
+        : /* Outputs */
+        : [counter] "r"((uint64_t)counter), [event] "r"((uint64_t)event),
+          [mask] "r"((uint64_t)1 << counter) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_pmu_disable_event_counter (uint32_t counter)
+  {
+    __asm__ volatile(
+
+        " msr pmcntenclr_el0, %[mask] \n"
+        " isb \n"
+
+        : /* Outputs */
+        : [mask] "r"((uint64_t)1 << counter) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) uint64_t
+  aarch64_architecture_pmu_get_event_counter (uint32_t counter)
+  {
+    uint64_t result;
+
+    __asm__ volatile(
+
+        " msr pmselr_el0, %[counter] \n"
+        " isb \n"
+        " mrs %[result], pmxevcntr_el0 \n"
+
+        : [result] "=r"(result) /* Outputs */
+        : [counter] "r"((uint64_t)counter) /* Inputs */
+        : /* Clobbers */
+    );
+
+    return result;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_pmu_set_event_counter (uint32_t counter,
+                                              uint64_t value)
+  {
+    __asm__ volatile(
+
+        " msr pmselr_el0, %[counter] \n"
+        " isb \n"
+        " msr pmxevcntr_el0, %[value] \n"
+
+        : /* Outputs */
+        : [counter] "r"((uint64_t)counter), [value] "r"(value) /* Inputs */
+        : /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_pmu_profile_record (
+      aarch64_architecture_pmu_profile_entry_t* entry, uint64_t cycles)
+  {
+    entry->count++;
+    entry->sum += cycles;
+    if (cycles < entry->min)
+      {
+        entry->min = cycles;
+      }
+    if (cycles > entry->max)
+      {
+        entry->max = cycles;
+      }
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::pmu
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) void
+  enable (void)
+  {
+    aarch64_architecture_pmu_enable ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  disable (void)
+  {
+    aarch64_architecture_pmu_disable ();
+  }
+
+  inline __attribute__ ((always_inline)) uint32_t
+  event_counters_count (void)
+  {
+    return aarch64_architecture_pmu_get_event_counters_count ();
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  cycles (void)
+  {
+    return aarch64_architecture_pmu_get_cycle_counter ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  configure_event_counter (uint32_t counter, uint32_t event)
+  {
+    aarch64_architecture_pmu_configure_event_counter (counter, event);
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  event_counter (uint32_t counter)
+  {
+    return aarch64_architecture_pmu_get_event_counter (counter);
+  }
+
+  template <uint32_t N>
+  inline __attribute__ ((always_inline)) uint64_t
+  event_counter (void)
+  {
+    static_assert (N < 31, "PMEVCNTR<n>_EL0 index out of range");
+
+    uint64_t result;
+
+    // PMEVCNTR<n>_EL0 is encoded as S3_3_C14_C(8 + n / 8)_(n % 8).
+    __asm__ volatile(
+
+        " mrs %[result], S3_3_C14_C%c[crm]_%c[op2] "
+
+        : [result] "=r"(result) /* Outputs */
+        : [crm] "i"(8 + N / 8), [op2] "i"(N % 8) /* Inputs */
+        : /* Clobbers */
+    );
+
+    return result;
+  }
+
+  inline __attribute__ ((always_inline))
+  profile_scope::profile_scope (profile_entry& entry) noexcept
+      : entry_{ entry }, begin_{ cycles () }
+  {
+  }
+
+  inline __attribute__ ((always_inline)) profile_scope::~profile_scope () noexcept
+  {
+    aarch64_architecture_pmu_profile_record (&entry_, cycles () - begin_);
+  }
+
+  inline void
+  dump (void)
+  {
+    aarch64_architecture_pmu_profile_dump ();
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::pmu
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_PMU_INLINES_H_
+
+// ----------------------------------------------------------------------------
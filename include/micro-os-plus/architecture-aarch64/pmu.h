@@ -0,0 +1,290 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_PMU_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_PMU_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/defines.h>
+#include <micro-os-plus/architecture-aarch64/types.h>
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Declarations of the AArch64 Performance Monitors Unit (PMUv3) functions.
+
+#if !defined(MICRO_OS_PLUS_INTEGER_PMU_PROFILE_ENTRIES)
+#define MICRO_OS_PLUS_INTEGER_PMU_PROFILE_ENTRIES (32)
+#endif
+
+// Common architectural events (ARM DDI 0487, D11.11).
+#define AARCH64_PMU_EVENT_SW_INCR (0x00)
+#define AARCH64_PMU_EVENT_L1I_CACHE_REFILL (0x01)
+#define AARCH64_PMU_EVENT_L1I_TLB_REFILL (0x02)
+#define AARCH64_PMU_EVENT_L1D_CACHE_REFILL (0x03)
+#define AARCH64_PMU_EVENT_L1D_CACHE (0x04)
+#define AARCH64_PMU_EVENT_L1D_TLB_REFILL (0x05)
+#define AARCH64_PMU_EVENT_LD_RETIRED (0x06)
+#define AARCH64_PMU_EVENT_ST_RETIRED (0x07)
+#define AARCH64_PMU_EVENT_INST_RETIRED (0x08)
+#define AARCH64_PMU_EVENT_EXC_TAKEN (0x09)
+#define AARCH64_PMU_EVENT_EXC_RETURN (0x0A)
+#define AARCH64_PMU_EVENT_BR_MIS_PRED (0x10)
+#define AARCH64_PMU_EVENT_CPU_CYCLES (0x11)
+#define AARCH64_PMU_EVENT_BR_PRED (0x12)
+#define AARCH64_PMU_EVENT_MEM_ACCESS (0x13)
+#define AARCH64_PMU_EVENT_L1I_CACHE (0x14)
+#define AARCH64_PMU_EVENT_L2D_CACHE (0x16)
+#define AARCH64_PMU_EVENT_L2D_CACHE_REFILL (0x17)
+#define AARCH64_PMU_EVENT_BUS_ACCESS (0x19)
+#define AARCH64_PMU_EVENT_INST_SPEC (0x1B)
+#define AARCH64_PMU_EVENT_BUS_CYCLES (0x1D)
+#define AARCH64_PMU_EVENT_BR_RETIRED (0x21)
+#define AARCH64_PMU_EVENT_BR_MIS_PRED_RETIRED (0x22)
+#define AARCH64_PMU_EVENT_STALL_FRONTEND (0x23)
+#define AARCH64_PMU_EVENT_STALL_BACKEND (0x24)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  /**
+   * Statistics accumulated for a profiled code section.
+   */
+  typedef struct aarch64_architecture_pmu_profile_entry_s
+  {
+    const char* name;
+    uint64_t count;
+    uint64_t sum;
+    uint64_t min;
+    uint64_t max;
+  } aarch64_architecture_pmu_profile_entry_t;
+
+  // --------------------------------------------------------------------------
+  // PMU counters in C.
+
+  /**
+   * Reset and start the cycle counter (64-bit) and the event counters.
+   */
+  static void
+  aarch64_architecture_pmu_enable (void);
+
+  /**
+   * Stop all counters.
+   */
+  static void
+  aarch64_architecture_pmu_disable (void);
+
+  /**
+   * Allow EL0 to read the counters.
+   */
+  static void
+  aarch64_architecture_pmu_enable_user_access (void);
+
+  /**
+   * Number of event counters implemented (PMCR_EL0.N).
+   */
+  static uint32_t
+  aarch64_architecture_pmu_get_event_counters_count (void);
+
+  /**
+   * Cycle counter getter (PMCCNTR_EL0).
+   */
+  static uint64_t
+  aarch64_architecture_pmu_get_cycle_counter (void);
+
+  /**
+   * Cycle counter setter (PMCCNTR_EL0).
+   */
+  static void
+  aarch64_architecture_pmu_set_cycle_counter (uint64_t value);
+
+  /**
+   * Program an event counter to count `event` (PMEVTYPER),
+   * clear it (PMEVCNTR) and start it.
+   */
+  static void
+  aarch64_architecture_pmu_configure_event_counter (uint32_t counter,
+                                                    uint32_t event);
+
+  /**
+   * Stop an event counter.
+   */
+  static void
+  aarch64_architecture_pmu_disable_event_counter (uint32_t counter);
+
+  /**
+   * Event counter getter (PMEVCNTR).
+   */
+  static uint64_t
+  aarch64_architecture_pmu_get_event_counter (uint32_t counter);
+
+  /**
+   * Event counter setter (PMEVCNTR).
+   */
+  static void
+  aarch64_architecture_pmu_set_event_counter (uint32_t counter,
+                                              uint64_t value);
+
+  // --------------------------------------------------------------------------
+  // Profile table in C.
+
+  /**
+   * Get the profile table entry for `name`, allocating it on first use.
+   * When the table is full, a shared overflow entry is returned.
+   * Not reentrant; call it once per site, usually from an initialiser.
+   */
+  aarch64_architecture_pmu_profile_entry_t*
+  aarch64_architecture_pmu_profile_register (const char* name);
+
+  /**
+   * Accumulate one measurement into a profile entry.
+   */
+  static void
+  aarch64_architecture_pmu_profile_record (
+      aarch64_architecture_pmu_profile_entry_t* entry, uint64_t cycles);
+
+  /**
+   * Clear the statistics of all registered entries.
+   */
+  void
+  aarch64_architecture_pmu_profile_reset (void);
+
+  /**
+   * Write the profile table, as CSV, to the host console via semihosting.
+   */
+  void
+  aarch64_architecture_pmu_profile_dump (void);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::pmu
+{
+  // --------------------------------------------------------------------------
+  // PMU counters in C++.
+
+  using profile_entry = aarch64_architecture_pmu_profile_entry_t;
+
+  /**
+   * Reset and start the cycle counter and the event counters.
+   */
+  void
+  enable (void);
+
+  /**
+   * Stop all counters.
+   */
+  void
+  disable (void);
+
+  /**
+   * Number of implemented event counters.
+   */
+  uint32_t
+  event_counters_count (void);
+
+  /**
+   * Cycle counter getter.
+   */
+  uint64_t
+  cycles (void);
+
+  /**
+   * Program an event counter and start it.
+   */
+  void
+  configure_event_counter (uint32_t counter, uint32_t event);
+
+  /**
+   * Event counter getter.
+   */
+  uint64_t
+  event_counter (uint32_t counter);
+
+  /**
+   * Event counter getter, with the counter number known at compile time;
+   * accesses PMEVCNTR<n>_EL0 directly, without going through PMSELR_EL0.
+   */
+  template <uint32_t N>
+  uint64_t
+  event_counter (void);
+
+  /**
+   * RAII object that measures the cycles spent in its scope and
+   * accumulates them into a profile table entry.
+   */
+  class profile_scope
+  {
+  public:
+    explicit profile_scope (profile_entry& entry) noexcept;
+
+    profile_scope (const profile_scope&) = delete;
+    profile_scope (profile_scope&&) = delete;
+    profile_scope&
+    operator= (const profile_scope&)
+        = delete;
+    profile_scope&
+    operator= (profile_scope&&)
+        = delete;
+
+    ~profile_scope () noexcept;
+
+  protected:
+    profile_entry& entry_;
+    uint64_t begin_;
+  };
+
+  /**
+   * Write the profile table to the host console.
+   */
+  void
+  dump (void);
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::pmu
+
+#define MICRO_OS_PLUS_PMU_CONCAT_(a, b) a##b
+#define MICRO_OS_PLUS_PMU_CONCAT(a, b) MICRO_OS_PLUS_PMU_CONCAT_ (a, b)
+
+/**
+ * Profile the rest of the enclosing scope under the given name.
+ * The table entry is registered only once, on first execution.
+ */
+#define MICRO_OS_PLUS_PMU_PROFILE_SCOPE(name)                                 \
+  static ::aarch64::architecture::pmu::profile_entry&                         \
+      MICRO_OS_PLUS_PMU_CONCAT (micro_os_plus_pmu_profile_entry_, __LINE__)   \
+      = *aarch64_architecture_pmu_profile_register (name);                    \
+  ::aarch64::architecture::pmu::profile_scope MICRO_OS_PLUS_PMU_CONCAT (      \
+      micro_os_plus_pmu_profile_scope_, __LINE__)                             \
+  {                                                                           \
+    MICRO_OS_PLUS_PMU_CONCAT (micro_os_plus_pmu_profile_entry_, __LINE__)     \
+  }
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_PMU_H_
+
+// ----------------------------------------------------------------------------
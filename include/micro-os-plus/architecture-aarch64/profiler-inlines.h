@@ -0,0 +1,70 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_PROFILER_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_PROFILER_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/profiler.h>
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the AArch64 PC-sampling profiler.
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::profiler
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) void
+  start (uint32_t frequency)
+  {
+    aarch64_architecture_profiler_start (frequency);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  stop (void)
+  {
+    aarch64_architecture_profiler_stop ();
+  }
+
+  inline __attribute__ ((always_inline)) bool
+  write (const char* path)
+  {
+    return aarch64_architecture_profiler_write (path) == 0;
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  samples (void)
+  {
+    return aarch64_architecture_profiler_get_samples_count ();
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  dropped (void)
+  {
+    return aarch64_architecture_profiler_get_dropped_count ();
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::profiler
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_PROFILER_INLINES_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,174 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_PROFILER_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_PROFILER_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/defines.h>
+#include <micro-os-plus/architecture-aarch64/types.h>
+#include <micro-os-plus/architecture-aarch64/exceptions.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Declarations of the AArch64 statistical PC-sampling profiler.
+//
+// The generic timer interrupts periodically and the interrupted PC
+// (ELR_EL1) is counted in a histogram covering the code, from
+// `__vectors_start` to `__etext`. Optionally, the frame pointer chain
+// is walked and the caller/callee pairs are counted as call graph
+// arcs; this requires the code to be compiled with
+// -fno-omit-frame-pointer.
+//
+// The result is written to the host as a `gmon.out` file, with the
+// semihosting file I/O, to be processed with `aarch64-none-elf-gprof`
+// (and further with tools like gprof2dot for call graphs).
+//
+// The application must route the timer interrupt (PPI 27 for the
+// virtual timer, 30 for the physical one) to
+// aarch64_architecture_profiler_interrupt_handler(); the profiler
+// takes over the generic timer while running.
+//
+// Each core has its own timer, so the profiler can run on all cores;
+// the histogram bins are not updated atomically, and rare lost
+// counts are accepted.
+
+// The number of 16-bit histogram bins; each covers a power of 2
+// number of bytes, large enough for the entire code to fit.
+#if !defined(MICRO_OS_PLUS_INTEGER_PROFILER_BINS)
+#define MICRO_OS_PLUS_INTEGER_PROFILER_BINS (8192)
+#endif // !defined(MICRO_OS_PLUS_INTEGER_PROFILER_BINS)
+
+// The number of call graph arcs; 0 disables the backtrace.
+#if !defined(MICRO_OS_PLUS_INTEGER_PROFILER_ARCS)
+#define MICRO_OS_PLUS_INTEGER_PROFILER_ARCS (0)
+#endif // !defined(MICRO_OS_PLUS_INTEGER_PROFILER_ARCS)
+
+// The maximum number of frame records walked for each sample.
+#if !defined(MICRO_OS_PLUS_INTEGER_PROFILER_BACKTRACE_DEPTH)
+#define MICRO_OS_PLUS_INTEGER_PROFILER_BACKTRACE_DEPTH (8)
+#endif // !defined(MICRO_OS_PLUS_INTEGER_PROFILER_BACKTRACE_DEPTH)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+  // PC-sampling profiler in C.
+
+  /**
+   * Clear the histogram and start sampling at `frequency` Hz,
+   * on the current core. The first call also registers an `atexit()`
+   * handler that writes `gmon.out`.
+   */
+  void
+  aarch64_architecture_profiler_start (uint32_t frequency);
+
+  /**
+   * Stop sampling on the current core.
+   */
+  void
+  aarch64_architecture_profiler_stop (void);
+
+  /**
+   * Count a sample; the frame pointer is used for the backtrace,
+   * if enabled. Called with interrupts disabled.
+   */
+  void
+  aarch64_architecture_profiler_sample (uintptr_t pc, uintptr_t fp);
+
+  /**
+   * To be called by the application for the generic timer interrupt;
+   * re-arms the timer and samples the interrupted context.
+   */
+  void
+  aarch64_architecture_profiler_interrupt_handler (
+      aarch64_architecture_exception_frame_t* frame);
+
+  /**
+   * Write the histogram and the arcs to a host file, in the gprof
+   * `gmon.out` format. Return 0, or -1 on error.
+   */
+  int
+  aarch64_architecture_profiler_write (const char* path);
+
+  /**
+   * The number of samples counted since the start.
+   */
+  uint64_t
+  aarch64_architecture_profiler_get_samples_count (void);
+
+  /**
+   * The number of samples, or arcs, that did not fit.
+   */
+  uint64_t
+  aarch64_architecture_profiler_get_dropped_count (void);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::profiler
+{
+  // --------------------------------------------------------------------------
+  // PC-sampling profiler in C++.
+
+  /**
+   * Start sampling at `frequency` Hz on the current core.
+   */
+  void
+  start (uint32_t frequency);
+
+  /**
+   * Stop sampling on the current core.
+   */
+  void
+  stop (void);
+
+  /**
+   * Write `gmon.out` to the host.
+   */
+  bool
+  write (const char* path = "gmon.out");
+
+  /**
+   * The number of samples counted.
+   */
+  uint64_t
+  samples (void);
+
+  /**
+   * The number of samples, or arcs, dropped.
+   */
+  uint64_t
+  dropped (void);
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::profiler
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_PROFILER_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,500 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_QUEUES_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_QUEUES_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/queues.h>
+#include <micro-os-plus/architecture-aarch64/atomics.h>
+#include <micro-os-plus/architecture-aarch64/exceptions.h>
+#include <micro-os-plus/architecture-aarch64/gic.h>
+#include <micro-os-plus/architecture-aarch64/instructions.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the AArch64 inter-core message queues.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+  // Queues in C.
+
+  static inline __attribute__ ((always_inline)) int
+  aarch64_architecture_spsc_queue_initialize (
+      aarch64_architecture_spsc_queue_t* queue, uint64_t* slots,
+      size_t capacity)
+  {
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0)
+      {
+        return -1;
+      }
+
+    queue->tail = 0;
+    queue->head_cache = 0;
+    queue->head = 0;
+    queue->tail_cache = 0;
+    queue->slots = slots;
+    queue->mask = capacity - 1;
+
+    return 0;
+  }
+
+  static inline __attribute__ ((always_inline)) size_t
+  aarch64_architecture_spsc_queue_push_n (
+      aarch64_architecture_spsc_queue_t* queue, const uint64_t* messages,
+      size_t count)
+  {
+    uint64_t tail = queue->tail;
+    uint64_t space = queue->mask + 1 - (tail - queue->head_cache);
+    if (space < count)
+      {
+        // Acquire: the consumer finished reading the slots.
+        queue->head_cache
+            = aarch64_architecture_load_acquire_64 (&queue->head);
+        space = queue->mask + 1 - (tail - queue->head_cache);
+        if (space < count)
+          {
+            count = (size_t)space;
+          }
+      }
+
+    for (size_t i = 0; i < count; ++i)
+      {
+        queue->slots[(tail + i) & queue->mask] = messages[i];
+      }
+    if (count != 0)
+      {
+        aarch64_architecture_store_release_64 (&queue->tail, tail + count);
+      }
+
+    return count;
+  }
+
+  static inline __attribute__ ((always_inline)) bool
+  aarch64_architecture_spsc_queue_push (
+      aarch64_architecture_spsc_queue_t* queue, uint64_t message)
+  {
+    return aarch64_architecture_spsc_queue_push_n (queue, &message, 1) != 0;
+  }
+
+  static inline __attribute__ ((always_inline)) size_t
+  aarch64_architecture_spsc_queue_pop_n (
+      aarch64_architecture_spsc_queue_t* queue, uint64_t* messages,
+      size_t count)
+  {
+    uint64_t head = queue->head;
+    uint64_t available = queue->tail_cache - head;
+    if (available < count)
+      {
+        // Acquire: the producer finished writing the slots.
+        queue->tail_cache
+            = aarch64_architecture_load_acquire_64 (&queue->tail);
+        available = queue->tail_cache - head;
+        if (available < count)
+          {
+            count = (size_t)available;
+          }
+      }
+
+    for (size_t i = 0; i < count; ++i)
+      {
+        messages[i] = queue->slots[(head + i) & queue->mask];
+      }
+    if (count != 0)
+      {
+        aarch64_architecture_store_release_64 (&queue->head, head + count);
+      }
+
+    return count;
+  }
+
+  static inline __attribute__ ((always_inline)) bool
+  aarch64_architecture_spsc_queue_pop (
+      aarch64_architecture_spsc_queue_t* queue, uint64_t* message)
+  {
+    return aarch64_architecture_spsc_queue_pop_n (queue, message, 1) != 0;
+  }
+
+  static inline __attribute__ ((always_inline)) bool
+  aarch64_architecture_spsc_queue_is_empty (
+      const aarch64_architecture_spsc_queue_t* queue)
+  {
+    return aarch64_architecture_load_acquire_64 (&queue->tail) == queue->head;
+  }
+
+  static inline __attribute__ ((always_inline)) int
+  aarch64_architecture_mpmc_queue_initialize (
+      aarch64_architecture_mpmc_queue_t* queue, uint64_t* slots,
+      size_t capacity)
+  {
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0)
+      {
+        return -1;
+      }
+
+    queue->producer_head = 0;
+    queue->producer_tail = 0;
+    queue->consumer_head = 0;
+    queue->consumer_tail = 0;
+    queue->slots = slots;
+    queue->mask = capacity - 1;
+
+    return 0;
+  }
+
+  static inline __attribute__ ((always_inline)) size_t
+  aarch64_architecture_mpmc_queue_push_n (
+      aarch64_architecture_mpmc_queue_t* queue, const uint64_t* messages,
+      size_t count)
+  {
+    aarch64_architecture_register_t daif
+        = aarch64_architecture_interrupts_save_and_disable ();
+
+    uint64_t head = queue->producer_head;
+    uint64_t n;
+    for (;;)
+      {
+        uint64_t space
+            = queue->mask + 1
+              - (head
+                 - aarch64_architecture_load_acquire_64 (
+                     &queue->consumer_tail));
+        n = (space < count) ? space : count;
+        if (n == 0)
+          {
+            aarch64_architecture_interrupts_restore (daif);
+            return 0;
+          }
+        uint64_t old = aarch64_architecture_atomic_compare_exchange_64 (
+            &queue->producer_head, head, head + n);
+        if (old == head)
+          {
+            break;
+          }
+        head = old;
+      }
+
+    for (uint64_t i = 0; i < n; ++i)
+      {
+        queue->slots[(head + i) & queue->mask] = messages[i];
+      }
+
+    // The earlier reservations are published first, in order.
+    while (aarch64_architecture_load_acquire_64 (&queue->producer_tail)
+           != head)
+      {
+      }
+    aarch64_architecture_store_release_64 (&queue->producer_tail, head + n);
+
+    aarch64_architecture_interrupts_restore (daif);
+
+    return (size_t)n;
+  }
+
+  static inline __attribute__ ((always_inline)) bool
+  aarch64_architecture_mpmc_queue_push (
+      aarch64_architecture_mpmc_queue_t* queue, uint64_t message)
+  {
+    return aarch64_architecture_mpmc_queue_push_n (queue, &message, 1) != 0;
+  }
+
+  static inline __attribute__ ((always_inline)) size_t
+  aarch64_architecture_mpmc_queue_pop_n (
+      aarch64_architecture_mpmc_queue_t* queue, uint64_t* messages,
+      size_t count)
+  {
+    aarch64_architecture_register_t daif
+        = aarch64_architecture_interrupts_save_and_disable ();
+
+    uint64_t head = queue->consumer_head;
+    uint64_t n;
+    for (;;)
+      {
+        uint64_t available
+            = aarch64_architecture_load_acquire_64 (&queue->producer_tail)
+              - head;
+        n = (available < count) ? available : count;
+        if (n == 0)
+          {
+            aarch64_architecture_interrupts_restore (daif);
+            return 0;
+          }
+        uint64_t old = aarch64_architecture_atomic_compare_exchange_64 (
+            &queue->consumer_head, head, head + n);
+        if (old == head)
+          {
+            break;
+          }
+        head = old;
+      }
+
+    for (uint64_t i = 0; i < n; ++i)
+      {
+        messages[i] = queue->slots[(head + i) & queue->mask];
+      }
+
+    while (aarch64_architecture_load_acquire_64 (&queue->consumer_tail)
+           != head)
+      {
+      }
+    aarch64_architecture_store_release_64 (&queue->consumer_tail, head + n);
+
+    aarch64_architecture_interrupts_restore (daif);
+
+    return (size_t)n;
+  }
+
+  static inline __attribute__ ((always_inline)) bool
+  aarch64_architecture_mpmc_queue_pop (
+      aarch64_architecture_mpmc_queue_t* queue, uint64_t* message)
+  {
+    return aarch64_architecture_mpmc_queue_pop_n (queue, message, 1) != 0;
+  }
+
+  static inline __attribute__ ((always_inline)) bool
+  aarch64_architecture_mpmc_queue_is_empty (
+      const aarch64_architecture_mpmc_queue_t* queue)
+  {
+    return aarch64_architecture_load_acquire_64 (&queue->producer_tail)
+           == queue->consumer_head;
+  }
+
+  // --------------------------------------------------------------------------
+  // Doorbells in C.
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_doorbell_initialize (
+      aarch64_architecture_doorbell_t* doorbell, uint32_t intid,
+      aarch64_architecture_register_t mpidr)
+  {
+    doorbell->armed = 0;
+    doorbell->intid = intid;
+    doorbell->mpidr = mpidr;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_doorbell_arm (
+      aarch64_architecture_doorbell_t* doorbell)
+  {
+    aarch64_architecture_store_release_32 (&doorbell->armed, 1);
+    // The flag must be visible before the queue is checked again.
+    aarch64_architecture_dmb_ish ();
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_doorbell_disarm (
+      aarch64_architecture_doorbell_t* doorbell)
+  {
+    aarch64_architecture_store_release_32 (&doorbell->armed, 0);
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_doorbell_sleep (
+      const aarch64_architecture_doorbell_t* doorbell)
+  {
+    if (doorbell->intid == AARCH64_DOORBELL_EVENT)
+      {
+        aarch64_architecture_wfe ();
+      }
+    else
+      {
+        aarch64_architecture_wfi ();
+      }
+  }
+
+  static inline __attribute__ ((always_inline)) bool
+  aarch64_architecture_doorbell_ring (
+      aarch64_architecture_doorbell_t* doorbell)
+  {
+    // The queue indices are published with `stlr`, which is ordered
+    // before the next `ldar`, so the consumer cannot miss both the
+    // message and the wake-up. Only one producer rings.
+    if (aarch64_architecture_load_acquire_32 (&doorbell->armed) == 0
+        || aarch64_architecture_atomic_swap_32 (&doorbell->armed, 0) == 0)
+      {
+        return false;
+      }
+
+    if (doorbell->intid == AARCH64_DOORBELL_EVENT)
+      {
+        aarch64_architecture_dsb_ish ();
+        aarch64_architecture_sev ();
+      }
+    else
+      {
+        aarch64_architecture_gic_send_sgi (doorbell->intid, doorbell->mpidr);
+      }
+
+    return true;
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture
+{
+  // --------------------------------------------------------------------------
+
+  template <size_t N>
+  inline spsc_queue<N>::spsc_queue ()
+  {
+    aarch64_architecture_spsc_queue_initialize (&queue_, slots_, N);
+  }
+
+  template <size_t N>
+  inline __attribute__ ((always_inline)) bool
+  spsc_queue<N>::push (uint64_t message)
+  {
+    return aarch64_architecture_spsc_queue_push (&queue_, message);
+  }
+
+  template <size_t N>
+  inline __attribute__ ((always_inline)) size_t
+  spsc_queue<N>::push (const uint64_t* messages, size_t count)
+  {
+    return aarch64_architecture_spsc_queue_push_n (&queue_, messages, count);
+  }
+
+  template <size_t N>
+  inline __attribute__ ((always_inline)) bool
+  spsc_queue<N>::pop (uint64_t& message)
+  {
+    return aarch64_architecture_spsc_queue_pop (&queue_, &message);
+  }
+
+  template <size_t N>
+  inline __attribute__ ((always_inline)) size_t
+  spsc_queue<N>::pop (uint64_t* messages, size_t count)
+  {
+    return aarch64_architecture_spsc_queue_pop_n (&queue_, messages, count);
+  }
+
+  template <size_t N>
+  inline __attribute__ ((always_inline)) bool
+  spsc_queue<N>::empty (void) const
+  {
+    return aarch64_architecture_spsc_queue_is_empty (&queue_);
+  }
+
+  template <size_t N>
+  constexpr size_t
+  spsc_queue<N>::capacity (void)
+  {
+    return N;
+  }
+
+  template <size_t N>
+  inline mpmc_queue<N>::mpmc_queue ()
+  {
+    aarch64_architecture_mpmc_queue_initialize (&queue_, slots_, N);
+  }
+
+  template <size_t N>
+  inline __attribute__ ((always_inline)) bool
+  mpmc_queue<N>::push (uint64_t message)
+  {
+    return aarch64_architecture_mpmc_queue_push (&queue_, message);
+  }
+
+  template <size_t N>
+  inline __attribute__ ((always_inline)) size_t
+  mpmc_queue<N>::push (const uint64_t* messages, size_t count)
+  {
+    return aarch64_architecture_mpmc_queue_push_n (&queue_, messages, count);
+  }
+
+  template <size_t N>
+  inline __attribute__ ((always_inline)) bool
+  mpmc_queue<N>::pop (uint64_t& message)
+  {
+    return aarch64_architecture_mpmc_queue_pop (&queue_, &message);
+  }
+
+  template <size_t N>
+  inline __attribute__ ((always_inline)) size_t
+  mpmc_queue<N>::pop (uint64_t* messages, size_t count)
+  {
+    return aarch64_architecture_mpmc_queue_pop_n (&queue_, messages, count);
+  }
+
+  template <size_t N>
+  inline __attribute__ ((always_inline)) bool
+  mpmc_queue<N>::empty (void) const
+  {
+    return aarch64_architecture_mpmc_queue_is_empty (&queue_);
+  }
+
+  template <size_t N>
+  constexpr size_t
+  mpmc_queue<N>::capacity (void)
+  {
+    return N;
+  }
+
+  inline doorbell::doorbell (uint32_t intid, register_t mpidr)
+  {
+    aarch64_architecture_doorbell_initialize (&doorbell_, intid, mpidr);
+  }
+
+  inline __attribute__ ((always_inline)) bool
+  doorbell::ring (void)
+  {
+    return aarch64_architecture_doorbell_ring (&doorbell_);
+  }
+
+  template <typename Predicate>
+  inline void
+  doorbell::wait (Predicate ready)
+  {
+    // A pending SGI wakes `wfi` even when masked; it is taken when
+    // the interrupts are restored.
+    register_t daif = aarch64_architecture_interrupts_save_and_disable ();
+    for (;;)
+      {
+        aarch64_architecture_doorbell_arm (&doorbell_);
+        if (ready ())
+          {
+            break;
+          }
+        aarch64_architecture_doorbell_sleep (&doorbell_);
+        aarch64_architecture_interrupts_restore (daif);
+        daif = aarch64_architecture_interrupts_save_and_disable ();
+      }
+    aarch64_architecture_doorbell_disarm (&doorbell_);
+    aarch64_architecture_interrupts_restore (daif);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_QUEUES_INLINES_H_
+
+// ----------------------------------------------------------------------------
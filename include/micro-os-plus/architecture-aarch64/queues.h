@@ -0,0 +1,380 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_QUEUES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_QUEUES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/types.h>
+#include <micro-os-plus/architecture-aarch64/cache.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Declarations of the AArch64 inter-core message queues.
+//
+// Bounded rings of 64-bit messages (values or pointers), with the
+// storage provided by the caller; the capacity must be a power of 2.
+// The indices written by the producers and by the consumers are on
+// separate cache lines, and are published with store-release and read
+// with load-acquire, so the messages need no other barriers.
+//
+// - The SPSC queue has one producer and one consumer; each side keeps
+//   a private copy of the other side's index, which is read again only
+//   when the ring looks full (or empty), so in steady state the shared
+//   lines move once per batch, not once per message.
+// - The MPMC queue has any number of producers and consumers; each
+//   side reserves a run of slots with a compare-and-swap on its head,
+//   copies the messages, then waits for the previous reservations to
+//   complete and advances its tail. The interrupts are masked from the
+//   reservation to the tail update, so a handler on the same core
+//   cannot wait for an interrupted reservation.
+//
+// The batch functions transfer as many messages as possible, up to
+// `count`, with a single index update, and return their number.
+//
+// A doorbell wakes the consumer core, with an SGI (ICC_SGI1R_EL1) or
+// with `sev`, only when it is armed, i.e. after the consumer found the
+// queue empty and before it sleeps; the producers call `ring()` after
+// each push, which costs a load while the consumer is busy.
+
+// The doorbell INTID that selects `sev`/`wfe` instead of an SGI.
+#define AARCH64_DOORBELL_EVENT (0xFFFFFFFFU)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  /**
+   * Single producer, single consumer queue.
+   */
+  typedef struct aarch64_architecture_spsc_queue_s
+  {
+    // Written by the producer.
+    __attribute__ ((aligned (MICRO_OS_PLUS_INTEGER_CACHE_LINE_SIZE)))
+    volatile uint64_t tail;
+    uint64_t head_cache;
+
+    // Written by the consumer.
+    __attribute__ ((aligned (MICRO_OS_PLUS_INTEGER_CACHE_LINE_SIZE)))
+    volatile uint64_t head;
+    uint64_t tail_cache;
+
+    // Read only.
+    __attribute__ ((aligned (MICRO_OS_PLUS_INTEGER_CACHE_LINE_SIZE)))
+    uint64_t* slots;
+    uint64_t mask;
+  } aarch64_architecture_spsc_queue_t;
+
+  /**
+   * Multiple producers, multiple consumers queue.
+   */
+  typedef struct aarch64_architecture_mpmc_queue_s
+  {
+    // Written by the producers.
+    __attribute__ ((aligned (MICRO_OS_PLUS_INTEGER_CACHE_LINE_SIZE)))
+    volatile uint64_t producer_head;
+    volatile uint64_t producer_tail;
+
+    // Written by the consumers.
+    __attribute__ ((aligned (MICRO_OS_PLUS_INTEGER_CACHE_LINE_SIZE)))
+    volatile uint64_t consumer_head;
+    volatile uint64_t consumer_tail;
+
+    // Read only.
+    __attribute__ ((aligned (MICRO_OS_PLUS_INTEGER_CACHE_LINE_SIZE)))
+    uint64_t* slots;
+    uint64_t mask;
+  } aarch64_architecture_mpmc_queue_t;
+
+  /**
+   * The wake-up of one consumer core.
+   */
+  typedef struct aarch64_architecture_doorbell_s
+  {
+    volatile uint32_t armed;
+    uint32_t intid;
+    aarch64_architecture_register_t mpidr;
+  } aarch64_architecture_doorbell_t;
+
+  // --------------------------------------------------------------------------
+  // Queues in C.
+
+  /**
+   * Use `slots` for the messages. Return 0, or -1 if `capacity` is not
+   * a power of 2.
+   */
+  static int
+  aarch64_architecture_spsc_queue_initialize (
+      aarch64_architecture_spsc_queue_t* queue, uint64_t* slots,
+      size_t capacity);
+
+  /**
+   * Append one message; return false if the queue is full.
+   */
+  static bool
+  aarch64_architecture_spsc_queue_push (
+      aarch64_architecture_spsc_queue_t* queue, uint64_t message);
+
+  static size_t
+  aarch64_architecture_spsc_queue_push_n (
+      aarch64_architecture_spsc_queue_t* queue, const uint64_t* messages,
+      size_t count);
+
+  /**
+   * Remove the oldest message; return false if the queue is empty.
+   */
+  static bool
+  aarch64_architecture_spsc_queue_pop (
+      aarch64_architecture_spsc_queue_t* queue, uint64_t* message);
+
+  static size_t
+  aarch64_architecture_spsc_queue_pop_n (
+      aarch64_architecture_spsc_queue_t* queue, uint64_t* messages,
+      size_t count);
+
+  static bool
+  aarch64_architecture_spsc_queue_is_empty (
+      const aarch64_architecture_spsc_queue_t* queue);
+
+  static int
+  aarch64_architecture_mpmc_queue_initialize (
+      aarch64_architecture_mpmc_queue_t* queue, uint64_t* slots,
+      size_t capacity);
+
+  static bool
+  aarch64_architecture_mpmc_queue_push (
+      aarch64_architecture_mpmc_queue_t* queue, uint64_t message);
+
+  static size_t
+  aarch64_architecture_mpmc_queue_push_n (
+      aarch64_architecture_mpmc_queue_t* queue, const uint64_t* messages,
+      size_t count);
+
+  static bool
+  aarch64_architecture_mpmc_queue_pop (
+      aarch64_architecture_mpmc_queue_t* queue, uint64_t* message);
+
+  static size_t
+  aarch64_architecture_mpmc_queue_pop_n (
+      aarch64_architecture_mpmc_queue_t* queue, uint64_t* messages,
+      size_t count);
+
+  static bool
+  aarch64_architecture_mpmc_queue_is_empty (
+      const aarch64_architecture_mpmc_queue_t* queue);
+
+  // --------------------------------------------------------------------------
+  // Doorbells in C.
+
+  /**
+   * Wake the core `mpidr` with the SGI `intid` (0-15), which must
+   * have a handler and be enabled on it, or, with
+   * AARCH64_DOORBELL_EVENT, wake all cores waiting in `wfe`.
+   */
+  static void
+  aarch64_architecture_doorbell_initialize (
+      aarch64_architecture_doorbell_t* doorbell, uint32_t intid,
+      aarch64_architecture_register_t mpidr);
+
+  /**
+   * Consumer: request a wake-up; check again that the queue is empty
+   * before sleeping. With an SGI, the interrupts must be masked from
+   * here to the sleep, so the interrupt is pending and not lost.
+   */
+  static void
+  aarch64_architecture_doorbell_arm (
+      aarch64_architecture_doorbell_t* doorbell);
+
+  static void
+  aarch64_architecture_doorbell_disarm (
+      aarch64_architecture_doorbell_t* doorbell);
+
+  /**
+   * Consumer: wait for the wake-up, in `wfi` or `wfe`; may return
+   * earlier.
+   */
+  static void
+  aarch64_architecture_doorbell_sleep (
+      const aarch64_architecture_doorbell_t* doorbell);
+
+  /**
+   * Producer: after a push, wake the consumer if it is armed; return
+   * true if it was.
+   */
+  static bool
+  aarch64_architecture_doorbell_ring (
+      aarch64_architecture_doorbell_t* doorbell);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture
+{
+  // --------------------------------------------------------------------------
+  // Queues in C++.
+
+  /**
+   * Single producer, single consumer queue of N messages.
+   */
+  template <size_t N>
+  class spsc_queue
+  {
+    static_assert (N != 0 && (N & (N - 1)) == 0,
+                   "The capacity must be a power of 2");
+
+  public:
+    spsc_queue ();
+
+    spsc_queue (const spsc_queue&) = delete;
+    spsc_queue (spsc_queue&&) = delete;
+    spsc_queue&
+    operator= (const spsc_queue&)
+        = delete;
+    spsc_queue&
+    operator= (spsc_queue&&)
+        = delete;
+
+    ~spsc_queue () = default;
+
+    bool
+    push (uint64_t message);
+
+    size_t
+    push (const uint64_t* messages, size_t count);
+
+    bool
+    pop (uint64_t& message);
+
+    size_t
+    pop (uint64_t* messages, size_t count);
+
+    bool
+    empty (void) const;
+
+    static constexpr size_t
+    capacity (void);
+
+  protected:
+    aarch64_architecture_spsc_queue_t queue_{};
+    uint64_t slots_[N];
+  };
+
+  /**
+   * Multiple producers, multiple consumers queue of N messages.
+   */
+  template <size_t N>
+  class mpmc_queue
+  {
+    static_assert (N != 0 && (N & (N - 1)) == 0,
+                   "The capacity must be a power of 2");
+
+  public:
+    mpmc_queue ();
+
+    mpmc_queue (const mpmc_queue&) = delete;
+    mpmc_queue (mpmc_queue&&) = delete;
+    mpmc_queue&
+    operator= (const mpmc_queue&)
+        = delete;
+    mpmc_queue&
+    operator= (mpmc_queue&&)
+        = delete;
+
+    ~mpmc_queue () = default;
+
+    bool
+    push (uint64_t message);
+
+    size_t
+    push (const uint64_t* messages, size_t count);
+
+    bool
+    pop (uint64_t& message);
+
+    size_t
+    pop (uint64_t* messages, size_t count);
+
+    bool
+    empty (void) const;
+
+    static constexpr size_t
+    capacity (void);
+
+  protected:
+    aarch64_architecture_mpmc_queue_t queue_{};
+    uint64_t slots_[N];
+  };
+
+  /**
+   * The wake-up of one consumer core.
+   */
+  class doorbell
+  {
+  public:
+    /**
+     * An SGI for the core `mpidr`, or AARCH64_DOORBELL_EVENT.
+     */
+    doorbell (uint32_t intid, register_t mpidr);
+
+    doorbell (const doorbell&) = delete;
+    doorbell (doorbell&&) = delete;
+    doorbell&
+    operator= (const doorbell&)
+        = delete;
+    doorbell&
+    operator= (doorbell&&)
+        = delete;
+
+    ~doorbell () = default;
+
+    /**
+     * Producer: wake the consumer if it is waiting.
+     */
+    bool
+    ring (void);
+
+    /**
+     * Consumer: sleep until `ready()` returns true, usually when the
+     * queue is no longer empty.
+     */
+    template <typename Predicate>
+    void
+    wait (Predicate ready);
+
+  protected:
+    aarch64_architecture_doorbell_t doorbell_;
+  };
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_QUEUES_H_
+
+// ----------------------------------------------------------------------------
@@ -17,8 +17,12 @@
 
 #include <stdint.h>
 
+#if defined(__cplusplus)
+#include <type_traits>
+#endif // defined(__cplusplus)
+
 // ----------------------------------------------------------------------------
-// Inline implementations for the AArch64 architecture instructions.
+// Inline implementations for the AArch64 architecture registers.
 
 #if defined(__cplusplus)
 extern "C"
@@ -28,27 +32,53 @@ extern "C"
   // --------------------------------------------------------------------------
 
   static inline __attribute__ ((always_inline)) aarch64_architecture_register_t
-  aarch64_architecture_get_msp (void)
+  aarch64_architecture_get_sp (void)
   {
-    uint32_t result;
+    aarch64_architecture_register_t value;
 
     __asm__ volatile(
 
-        "msr %0, msp"
+        " mov %[value], sp "
 
-        : "=r"(result) /* Outputs */
+        : [value] "=r"(value) /* Outputs */
         : /* Inputs */
         : /* Clobbers */
     );
 
-    return result;
+    return value;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_set_sp (aarch64_architecture_register_t value)
+  {
+    __asm__ volatile(
+
+        " mov sp, %[value] "
+
+        : /* Outputs */
+        : [value] "r"(value) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) aarch64_architecture_register_t
+  aarch64_architecture_get_msp (void)
+  {
+    return aarch64_architecture_get_sp ();
   }
 
   static inline __attribute__ ((always_inline))
   micro_os_plus_architecture_register_t
   micro_os_plus_architecture_get_sp (void)
   {
-    return aarch64_architecture_get_msp ();
+    return aarch64_architecture_get_sp ();
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  micro_os_plus_architecture_set_sp (
+      micro_os_plus_architecture_register_t value)
+  {
+    aarch64_architecture_set_sp (value);
   }
 
   // --------------------------------------------------------------------------
@@ -61,19 +91,289 @@ extern "C"
 
 #if defined(__cplusplus)
 
+// ----------------------------------------------------------------------------
+// The `mrs`/`msr` instructions must name the register in the assembly
+// string, which must be a literal; these macros define the access for
+// one register, in the global scope. The names are those of the
+// assembler, in any case.
+
+#define AARCH64_SYSREG_READ(reg)                                              \
+  static inline __attribute__ ((always_inline))                               \
+  ::aarch64::architecture::register_t                                         \
+  read (void)                                                                 \
+  {                                                                           \
+    ::aarch64::architecture::register_t value;                                \
+    __asm__ volatile(" mrs %[value], " #reg " " : [value] "=r"(value));       \
+    return value;                                                             \
+  }
+
+#define AARCH64_SYSREG_WRITE(reg)                                             \
+  static inline __attribute__ ((always_inline)) void                          \
+  write (::aarch64::architecture::register_t value)                           \
+  {                                                                           \
+    __asm__ volatile(" msr " #reg ", %[value] "                               \
+                     :                                                        \
+                     : [value] "r"(value)                                     \
+                     : "memory");                                             \
+  }
+
+#define AARCH64_SYSREG_RO(reg)                                                \
+  template <>                                                                 \
+  struct aarch64::architecture::registers::sysreg_access<#reg>                \
+  {                                                                           \
+    AARCH64_SYSREG_READ (reg)                                                 \
+  }
+
+#define AARCH64_SYSREG_WO(reg)                                                \
+  template <>                                                                 \
+  struct aarch64::architecture::registers::sysreg_access<#reg>                \
+  {                                                                           \
+    AARCH64_SYSREG_WRITE (reg)                                                \
+  }
+
+#define AARCH64_SYSREG_RW(reg)                                                \
+  template <>                                                                 \
+  struct aarch64::architecture::registers::sysreg_access<#reg>                \
+  {                                                                           \
+    AARCH64_SYSREG_READ (reg)                                                 \
+    AARCH64_SYSREG_WRITE (reg)                                                \
+  }
+
+// ----------------------------------------------------------------------------
+
 namespace aarch64::architecture::registers
 {
   // --------------------------------------------------------------------------
 
+  inline __attribute__ ((always_inline)) register_t
+  sp (void)
+  {
+    return aarch64_architecture_get_sp ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  sp (register_t value)
+  {
+    aarch64_architecture_set_sp (value);
+  }
+
   inline __attribute__ ((always_inline)) register_t
   msp (void)
   {
-    return aarch64_architecture_get_msp ();
+    return aarch64_architecture_get_sp ();
   }
 
   // --------------------------------------------------------------------------
+
+  template <size_t N>
+  constexpr sysreg_name<N>::sysreg_name (const char (&name)[N])
+  {
+    for (size_t i = 0; i < N; ++i)
+      {
+        value[i] = name[i];
+      }
+  }
+
+  template <sysreg_name Name, unsigned Lsb, unsigned Width, typename T>
+  constexpr T
+  field<Name, Lsb, Width, T>::get (register_t value)
+  {
+    return static_cast<T> ((value & mask) >> Lsb);
+  }
+
+  template <sysreg_name Name, unsigned Lsb, unsigned Width, typename T>
+  constexpr field_value<Name>
+  field<Name, Lsb, Width, T>::operator() (T value) const
+  {
+    return { mask, (static_cast<register_t> (value) << Lsb) & mask };
+  }
+
+  template <sysreg_name Name>
+  inline __attribute__ ((always_inline)) register_t
+  sysreg<Name>::read (void)
+  {
+    return sysreg_access<Name>::read ();
+  }
+
+  template <sysreg_name Name>
+  inline __attribute__ ((always_inline)) void
+  sysreg<Name>::write (register_t value)
+  {
+    sysreg_access<Name>::write (value);
+  }
+
+  template <sysreg_name Name>
+  template <unsigned Lsb, unsigned Width, typename T>
+  inline __attribute__ ((always_inline)) T
+  sysreg<Name>::read (field<Name, Lsb, Width, T> f)
+  {
+    return f.get (sysreg_access<Name>::read ());
+  }
+
+  template <sysreg_name Name>
+  template <typename... Values>
+  inline __attribute__ ((always_inline)) void
+  sysreg<Name>::modify (Values... values)
+  {
+    static_assert ((std::is_same_v<Values, field_value<Name>> && ...),
+                   "fields of a different register");
+
+    register_t mask = (register_t{ 0 } | ... | values.mask);
+    register_t bits = (register_t{ 0 } | ... | values.bits);
+
+    sysreg_access<Name>::write ((sysreg_access<Name>::read () & ~mask)
+                                | bits);
+  }
+
+  template <sysreg_name Name>
+  template <typename... Values>
+  inline __attribute__ ((always_inline)) void
+  sysreg<Name>::set (Values... values)
+  {
+    static_assert ((std::is_same_v<Values, field_value<Name>> && ...),
+                   "fields of a different register");
+
+    sysreg_access<Name>::write ((register_t{ 0 } | ... | values.bits));
+  }
+
+  // --------------------------------------------------------------------------
+  // Fields of the registers used by this package.
+
+  namespace sctlr_el1
+  {
+    inline constexpr field<"SCTLR_EL1", 0, 1, bool> m{};
+    inline constexpr field<"SCTLR_EL1", 1, 1, bool> a{};
+    inline constexpr field<"SCTLR_EL1", 2, 1, bool> c{};
+    inline constexpr field<"SCTLR_EL1", 3, 1, bool> sa{};
+    inline constexpr field<"SCTLR_EL1", 12, 1, bool> i{};
+    inline constexpr field<"SCTLR_EL1", 19, 1, bool> wxn{};
+  } // namespace sctlr_el1
+
+  namespace cpacr_el1
+  {
+    inline constexpr field<"CPACR_EL1", 16, 2, uint32_t> zen{};
+    inline constexpr field<"CPACR_EL1", 20, 2, uint32_t> fpen{};
+  } // namespace cpacr_el1
+
+  namespace cntv_ctl_el0
+  {
+    inline constexpr field<"CNTV_CTL_EL0", 0, 1, bool> enable{};
+    inline constexpr field<"CNTV_CTL_EL0", 1, 1, bool> imask{};
+    inline constexpr field<"CNTV_CTL_EL0", 2, 1, bool> istatus{};
+  } // namespace cntv_ctl_el0
+
+  namespace cntp_ctl_el0
+  {
+    inline constexpr field<"CNTP_CTL_EL0", 0, 1, bool> enable{};
+    inline constexpr field<"CNTP_CTL_EL0", 1, 1, bool> imask{};
+    inline constexpr field<"CNTP_CTL_EL0", 2, 1, bool> istatus{};
+  } // namespace cntp_ctl_el0
+
+  namespace daif
+  {
+    inline constexpr field<"DAIF", 6, 1, bool> f{};
+    inline constexpr field<"DAIF", 7, 1, bool> i{};
+    inline constexpr field<"DAIF", 8, 1, bool> a{};
+    inline constexpr field<"DAIF", 9, 1, bool> d{};
+  } // namespace daif
+
+  namespace mpidr_el1
+  {
+    inline constexpr field<"MPIDR_EL1", 0, 8, uint32_t> aff0{};
+    inline constexpr field<"MPIDR_EL1", 8, 8, uint32_t> aff1{};
+    inline constexpr field<"MPIDR_EL1", 16, 8, uint32_t> aff2{};
+    inline constexpr field<"MPIDR_EL1", 24, 1, bool> mt{};
+    inline constexpr field<"MPIDR_EL1", 32, 8, uint32_t> aff3{};
+  } // namespace mpidr_el1
+
+  namespace pmcr_el0
+  {
+    inline constexpr field<"PMCR_EL0", 0, 1, bool> e{};
+    inline constexpr field<"PMCR_EL0", 1, 1, bool> p{};
+    inline constexpr field<"PMCR_EL0", 2, 1, bool> c{};
+    inline constexpr field<"PMCR_EL0", 6, 1, bool> lc{};
+    inline constexpr field<"PMCR_EL0", 11, 5, uint32_t> n{};
+  } // namespace pmcr_el0
+
+  namespace id_aa64isar0_el1
+  {
+    inline constexpr field<"ID_AA64ISAR0_EL1", 4, 4, uint32_t> aes{};
+    inline constexpr field<"ID_AA64ISAR0_EL1", 8, 4, uint32_t> sha1{};
+    inline constexpr field<"ID_AA64ISAR0_EL1", 12, 4, uint32_t> sha2{};
+    inline constexpr field<"ID_AA64ISAR0_EL1", 16, 4, uint32_t> crc32{};
+    inline constexpr field<"ID_AA64ISAR0_EL1", 20, 4, uint32_t> atomic{};
+  } // namespace id_aa64isar0_el1
+
+  namespace id_aa64pfr0_el1
+  {
+    inline constexpr field<"ID_AA64PFR0_EL1", 16, 4, uint32_t> fp{};
+    inline constexpr field<"ID_AA64PFR0_EL1", 20, 4, uint32_t> advsimd{};
+    inline constexpr field<"ID_AA64PFR0_EL1", 24, 4, uint32_t> gic{};
+    inline constexpr field<"ID_AA64PFR0_EL1", 32, 4, uint32_t> sve{};
+  } // namespace id_aa64pfr0_el1
+
+  namespace ctr_el0
+  {
+    inline constexpr field<"CTR_EL0", 0, 4, uint32_t> iminline{};
+    inline constexpr field<"CTR_EL0", 16, 4, uint32_t> dminline{};
+  } // namespace ctr_el0
+
+  // --------------------------------------------------------------------------
 } // namespace aarch64::architecture::registers
 
+// ----------------------------------------------------------------------------
+// The registers known to the package; more can be added by the
+// application, with the same macros.
+
+AARCH64_SYSREG_RO (CurrentEL);
+AARCH64_SYSREG_RW (DAIF);
+AARCH64_SYSREG_RW (SPSel);
+AARCH64_SYSREG_RW (SP_EL0);
+AARCH64_SYSREG_RW (ELR_EL1);
+AARCH64_SYSREG_RW (SPSR_EL1);
+AARCH64_SYSREG_RO (ESR_EL1);
+AARCH64_SYSREG_RO (FAR_EL1);
+AARCH64_SYSREG_RO (ISR_EL1);
+AARCH64_SYSREG_RW (VBAR_EL1);
+
+AARCH64_SYSREG_RO (MIDR_EL1);
+AARCH64_SYSREG_RO (MPIDR_EL1);
+AARCH64_SYSREG_RO (CTR_EL0);
+AARCH64_SYSREG_RO (DCZID_EL0);
+AARCH64_SYSREG_RO (ID_AA64ISAR0_EL1);
+AARCH64_SYSREG_RO (ID_AA64PFR0_EL1);
+AARCH64_SYSREG_RO (ID_AA64MMFR0_EL1);
+
+AARCH64_SYSREG_RW (SCTLR_EL1);
+AARCH64_SYSREG_RW (CPACR_EL1);
+AARCH64_SYSREG_RW (TCR_EL1);
+AARCH64_SYSREG_RW (MAIR_EL1);
+AARCH64_SYSREG_RW (TTBR0_EL1);
+AARCH64_SYSREG_RW (TTBR1_EL1);
+
+AARCH64_SYSREG_RW (TPIDR_EL0);
+AARCH64_SYSREG_RW (TPIDRRO_EL0);
+AARCH64_SYSREG_RW (TPIDR_EL1);
+
+AARCH64_SYSREG_RO (CNTFRQ_EL0);
+AARCH64_SYSREG_RO (CNTVCT_EL0);
+AARCH64_SYSREG_RO (CNTPCT_EL0);
+AARCH64_SYSREG_RW (CNTKCTL_EL1);
+AARCH64_SYSREG_RW (CNTV_CTL_EL0);
+AARCH64_SYSREG_RW (CNTV_CVAL_EL0);
+AARCH64_SYSREG_RW (CNTP_CTL_EL0);
+AARCH64_SYSREG_RW (CNTP_CVAL_EL0);
+
+AARCH64_SYSREG_RW (PMCR_EL0);
+AARCH64_SYSREG_RW (PMCCNTR_EL0);
+AARCH64_SYSREG_RW (PMCNTENSET_EL0);
+AARCH64_SYSREG_RW (PMUSERENR_EL0);
+
+AARCH64_SYSREG_RW (FPCR);
+AARCH64_SYSREG_RW (FPSR);
+
+// ----------------------------------------------------------------------------
+
 namespace micro_os_plus::architecture::registers
 {
   // --------------------------------------------------------------------------
@@ -84,6 +384,12 @@ namespace micro_os_plus::architecture::registers
     return micro_os_plus_architecture_get_sp ();
   }
 
+  inline __attribute__ ((always_inline)) void
+  sp (register_t value)
+  {
+    micro_os_plus_architecture_set_sp (value);
+  }
+
   // --------------------------------------------------------------------------
 } // namespace micro_os_plus::architecture::registers
 
@@ -10,17 +10,18 @@
  * be obtained from https://opensource.org/licenses/MIT/.
  */
 
-#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_INSTRUCTIONS_H_
-#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_INSTRUCTIONS_H_
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_REGISTERS_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_REGISTERS_H_
 
 // ----------------------------------------------------------------------------
 
 #include <micro-os-plus/architecture-aarch64/defines.h>
 
+#include <stddef.h>
 #include <stdint.h>
 
 // ----------------------------------------------------------------------------
-// Declarations of AArch64 functions to wrap architecture instructions.
+// Declarations of AArch64 functions to access the architecture registers.
 
 #if defined(__cplusplus)
 extern "C"
@@ -31,12 +32,25 @@ extern "C"
   // Architecture registers getters and mutators in C.
 
   /**
-   * Main Stack Pointer getter.
+   * Stack Pointer getter; the SP selected by SPSel, 64-bit.
    */
   static aarch64_architecture_register_t
-  aarch64_architecture_get_msp (void);
+  aarch64_architecture_get_sp (void);
 
-  // TODO: add setter.
+  /**
+   * Stack Pointer setter. The compiler is not aware of the change,
+   * use it only where no locals live on the stack (startup, context
+   * switch).
+   */
+  static void
+  aarch64_architecture_set_sp (aarch64_architecture_register_t value);
+
+  /**
+   * Kept for compatibility; AArch64 has no MSP, same as
+   * `aarch64_architecture_get_sp()`.
+   */
+  static aarch64_architecture_register_t
+  aarch64_architecture_get_msp (void) __attribute__ ((deprecated));
 
   // --------------------------------------------------------------------------
   // Portable architecture assembly instructions in C.
@@ -47,7 +61,12 @@ extern "C"
   static micro_os_plus_architecture_register_t
   micro_os_plus_architecture_get_sp (void);
 
-  // TODO: add setter.
+  /**
+   * Stack Pointer setter.
+   */
+  static void
+  micro_os_plus_architecture_set_sp (
+      micro_os_plus_architecture_register_t value);
 
   // --------------------------------------------------------------------------
 
@@ -62,15 +81,124 @@ extern "C"
 namespace aarch64::architecture::registers
 {
   // --------------------------------------------------------------------------
-  // Architecture getters in C++.
+  // Architecture getters and setters in C++.
 
   /**
-   * Main Stack Pointer getter.
+   * Stack Pointer getter.
    */
   register_t
+  sp (void);
+
+  /**
+   * Stack Pointer setter.
+   */
+  void
+  sp (register_t value);
+
+  /**
+   * Kept for compatibility, same as `sp()`.
+   */
+  [[deprecated ("use sp()")]] register_t
   msp (void);
 
-  // TODO: add setter.
+  // --------------------------------------------------------------------------
+  // Typed system registers access.
+
+  /**
+   * A system register name, as a template argument
+   * (like `sysreg<"CNTVCT_EL0">`).
+   */
+  template <size_t N>
+  struct sysreg_name
+  {
+    constexpr sysreg_name (const char (&name)[N]);
+
+    char value[N];
+  };
+
+  /**
+   * The `mrs`/`msr` instructions for a register, defined with
+   * `AARCH64_SYSREG_RO()`, `AARCH64_SYSREG_WO()` or `AARCH64_SYSREG_RW()`;
+   * a register not defined there, or a missing direction, is a
+   * compile error.
+   */
+  template <sysreg_name Name>
+  struct sysreg_access;
+
+  /**
+   * A field value, the mask and the bits in position, for a single
+   * write of several fields.
+   */
+  template <sysreg_name Name>
+  struct field_value
+  {
+    register_t mask;
+    register_t bits;
+  };
+
+  /**
+   * A typed bit field of a system register, `Width` bits
+   * at `Lsb`.
+   */
+  template <sysreg_name Name, unsigned Lsb, unsigned Width,
+            typename T = register_t>
+  struct field
+  {
+    static_assert (Width > 0 && Lsb + Width <= 64, "field out of range");
+
+    static constexpr register_t mask
+        = ((Width == 64) ? ~register_t{ 0 }
+                         : ((register_t{ 1 } << Width) - 1))
+          << Lsb;
+
+    /**
+     * Get the field from a register value.
+     */
+    static constexpr T
+    get (register_t value);
+
+    /**
+     * Build a field value, to be passed to `sysreg<>::modify()`.
+     */
+    constexpr field_value<Name>
+    operator() (T value) const;
+  };
+
+  /**
+   * A system register, with one `mrs` per read and one `msr` per write.
+   */
+  template <sysreg_name Name>
+  struct sysreg
+  {
+    static register_t
+    read (void);
+
+    static void
+    write (register_t value);
+
+    /**
+     * Read a field.
+     */
+    template <unsigned Lsb, unsigned Width, typename T>
+    static T
+    read (field<Name, Lsb, Width, T> f);
+
+    /**
+     * Read-modify-write of one or more fields, with a single read and
+     * a single write; with constant values the masks are folded
+     * at compile time.
+     */
+    template <typename... Values>
+    static void
+    modify (Values... values);
+
+    /**
+     * Write the fields, all other bits cleared, without reading.
+     */
+    template <typename... Values>
+    static void
+    set (Values... values);
+  };
 
   // --------------------------------------------------------------------------
 } // namespace aarch64::architecture::registers
@@ -81,12 +209,16 @@ namespace micro_os_plus::architecture::registers
   // Portable architecture assembly instructions in C++.
 
   /**
-   * Main Stack Pointer getter.
+   * Stack Pointer getter.
    */
   register_t
   sp (void);
 
-  // TODO: add setter.
+  /**
+   * Stack Pointer setter.
+   */
+  void
+  sp (register_t value);
 
   // --------------------------------------------------------------------------
 } // namespace micro_os_plus::architecture::registers
@@ -95,6 +227,6 @@ namespace micro_os_plus::architecture::registers
 
 // ----------------------------------------------------------------------------
 
-#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_INSTRUCTIONS_H_
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_REGISTERS_H_
 
 // ----------------------------------------------------------------------------
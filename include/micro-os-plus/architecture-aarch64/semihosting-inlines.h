@@ -38,30 +38,55 @@ extern "C"
 #define AngelSVC 0xF000
 #define AngelSVCInsn "hlt"
 
+// Semihosting operation numbers (Arm Semihosting Specification v3).
+#define AARCH64_SEMIHOSTING_SYS_OPEN (0x01)
+#define AARCH64_SEMIHOSTING_SYS_CLOSE (0x02)
+#define AARCH64_SEMIHOSTING_SYS_WRITEC (0x03)
+#define AARCH64_SEMIHOSTING_SYS_WRITE0 (0x04)
+#define AARCH64_SEMIHOSTING_SYS_WRITE (0x05)
+#define AARCH64_SEMIHOSTING_SYS_READ (0x06)
+#define AARCH64_SEMIHOSTING_SYS_READC (0x07)
+#define AARCH64_SEMIHOSTING_SYS_ISERROR (0x08)
+#define AARCH64_SEMIHOSTING_SYS_ISTTY (0x09)
+#define AARCH64_SEMIHOSTING_SYS_SEEK (0x0A)
+#define AARCH64_SEMIHOSTING_SYS_FLEN (0x0C)
+#define AARCH64_SEMIHOSTING_SYS_TMPNAM (0x0D)
+#define AARCH64_SEMIHOSTING_SYS_REMOVE (0x0E)
+#define AARCH64_SEMIHOSTING_SYS_RENAME (0x0F)
+#define AARCH64_SEMIHOSTING_SYS_CLOCK (0x10)
+#define AARCH64_SEMIHOSTING_SYS_TIME (0x11)
+#define AARCH64_SEMIHOSTING_SYS_SYSTEM (0x12)
+#define AARCH64_SEMIHOSTING_SYS_ERRNO (0x13)
+#define AARCH64_SEMIHOSTING_SYS_GET_CMDLINE (0x15)
+#define AARCH64_SEMIHOSTING_SYS_HEAPINFO (0x16)
+#define AARCH64_SEMIHOSTING_SYS_EXIT (0x18)
+#define AARCH64_SEMIHOSTING_SYS_EXIT_EXTENDED (0x20)
+#define AARCH64_SEMIHOSTING_SYS_ELAPSED (0x30)
+#define AARCH64_SEMIHOSTING_SYS_TICKFREQ (0x31)
+
   static inline __attribute__ ((always_inline))
   micro_os_plus_semihosting_response_t
   micro_os_plus_semihosting_call_host (
       int reason, micro_os_plus_semihosting_param_block_t* arg)
   {
-    micro_os_plus_semihosting_response_t value;
+    // The AArch64 semihosting ABI passes the operation in w0 and the
+    // parameter block address in x1; only x0 is changed, with the
+    // result. The host may read or write the memory pointed by the
+    // parameter block.
+    register micro_os_plus_semihosting_response_t value __asm__ ("x0")
+        = reason;
+    register micro_os_plus_semihosting_param_block_t* block __asm__ ("x1")
+        = arg;
+
     __asm__ volatile(
 
-        " mov w0, %w[rsn] \n"
-        " mov x1, %[arg] \n"
         " " AngelSVCInsn " %[svc] \n"
-        " mov %[val], x0 \n"
 
-        : [val] "=r"(value) /* Outputs */
-        : [rsn] "r"(reason), [arg] "r"(arg), [svc] "n"(AngelSVC) /* Inputs */
-        : "x0", "x1", "x2", "x3", "x17", "x30", "memory", "cc"
-        /* Clobbers x0 and x1, and lr if in supervisor mode */
+        : "+r"(value) /* Outputs */
+        : "r"(block), [svc] "n"(AngelSVC) /* Inputs */
+        : "memory" /* Clobbers */
     );
 
-    // Accordingly to page 13-77 of ARM DUI 0040D other registers
-    // can also be clobbered. Some memory positions may also be
-    // changed by a system call, so they should not be kept in
-    // registers. Note: we are assuming the manual is right and
-    // Angel is respecting the APCS.
     return value;
   }
 
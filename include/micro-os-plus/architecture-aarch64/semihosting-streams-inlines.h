@@ -0,0 +1,203 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SEMIHOSTING_STREAMS_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SEMIHOSTING_STREAMS_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/semihosting-streams.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the AArch64 buffered semihosting streams.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) int
+  aarch64_architecture_semihosting_stream_putc (
+      aarch64_architecture_semihosting_stream_t* stream, int c)
+  {
+    // Fast path, only store in the buffer; the newline of line
+    // buffered streams and the full buffer go the slow path.
+    if ((stream->head - stream->tail) < stream->size
+        && (c != '\n'
+            || !(stream->flags & AARCH64_SEMIHOSTING_STREAM_LINE_BUFFERED)))
+      {
+        stream->buffer[stream->head & (stream->size - 1)] = (uint8_t)c;
+        ++stream->head;
+        return (uint8_t)c;
+      }
+
+    uint8_t ch = (uint8_t)c;
+    if (aarch64_architecture_semihosting_stream_write (stream, &ch, 1) != 1)
+      {
+        return -1;
+      }
+    return ch;
+  }
+
+  static inline __attribute__ ((always_inline)) int
+  aarch64_architecture_semihosting_stream_getc (
+      aarch64_architecture_semihosting_stream_t* stream)
+  {
+    if (stream->head != stream->tail)
+      {
+        uint8_t ch = stream->buffer[stream->tail & (stream->size - 1)];
+        ++stream->tail;
+        return ch;
+      }
+
+    uint8_t ch;
+    if (aarch64_architecture_semihosting_stream_read (stream, &ch, 1) != 1)
+      {
+        return -1;
+      }
+    return ch;
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::semihosting
+{
+  // --------------------------------------------------------------------------
+
+  template <size_t N>
+  inline stream<N>::stream ()
+  {
+    stream_.handle = -1;
+    stream_.buffer = buffer_;
+    stream_.size = N;
+    stream_.head = 0;
+    stream_.tail = 0;
+    stream_.flags = 0;
+  }
+
+  template <size_t N>
+  inline stream<N>::stream (const char* path, uint32_t mode) : stream ()
+  {
+    open (path, mode);
+  }
+
+  template <size_t N>
+  inline stream<N>::~stream ()
+  {
+    close ();
+  }
+
+  template <size_t N>
+  inline bool
+  stream<N>::open (const char* path, uint32_t mode)
+  {
+    return aarch64_architecture_semihosting_stream_open (&stream_, path, mode,
+                                                         buffer_, N)
+           == 0;
+  }
+
+  template <size_t N>
+  inline bool
+  stream<N>::is_open (void) const
+  {
+    return stream_.handle != -1;
+  }
+
+  template <size_t N>
+  inline ptrdiff_t
+  stream<N>::write (const void* data, size_t count)
+  {
+    return aarch64_architecture_semihosting_stream_write (&stream_, data,
+                                                          count);
+  }
+
+  template <size_t N>
+  inline ptrdiff_t
+  stream<N>::puts (const char* str)
+  {
+    return aarch64_architecture_semihosting_stream_puts (&stream_, str);
+  }
+
+  template <size_t N>
+  inline __attribute__ ((always_inline)) int
+  stream<N>::putc (int c)
+  {
+    return aarch64_architecture_semihosting_stream_putc (&stream_, c);
+  }
+
+  template <size_t N>
+  inline bool
+  stream<N>::flush (void)
+  {
+    return aarch64_architecture_semihosting_stream_flush (&stream_) == 0;
+  }
+
+  template <size_t N>
+  inline ptrdiff_t
+  stream<N>::read (void* data, size_t count)
+  {
+    return aarch64_architecture_semihosting_stream_read (&stream_, data,
+                                                         count);
+  }
+
+  template <size_t N>
+  inline __attribute__ ((always_inline)) int
+  stream<N>::getc (void)
+  {
+    return aarch64_architecture_semihosting_stream_getc (&stream_);
+  }
+
+  template <size_t N>
+  inline bool
+  stream<N>::seek (size_t position)
+  {
+    return aarch64_architecture_semihosting_stream_seek (&stream_, position)
+           == 0;
+  }
+
+  template <size_t N>
+  inline ptrdiff_t
+  stream<N>::length (void)
+  {
+    return aarch64_architecture_semihosting_stream_length (&stream_);
+  }
+
+  template <size_t N>
+  inline bool
+  stream<N>::close (void)
+  {
+    return aarch64_architecture_semihosting_stream_close (&stream_) == 0;
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::semihosting
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SEMIHOSTING_STREAMS_INLINES_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,266 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SEMIHOSTING_STREAMS_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SEMIHOSTING_STREAMS_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/defines.h>
+#include <micro-os-plus/architecture-aarch64/types.h>
+#include <micro-os-plus/architecture-aarch64/semihosting-inlines.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Declarations of the AArch64 buffered semihosting streams.
+//
+// Each semihosting call stops the core and round-trips to the host
+// (debugger or emulator), which costs far more than the transfer
+// itself. The streams accumulate output in a ring buffer and flush
+// it with a single SYS_WRITE, and refill input with a single
+// SYS_READ of the entire buffer (read-ahead).
+//
+// A stream is either for input or for output, and is not thread
+// safe; use one stream per core/thread, or protect it externally.
+//
+// The buffer size must be a power of 2.
+
+#if !defined(MICRO_OS_PLUS_INTEGER_SEMIHOSTING_STREAM_BUFFER_SIZE)
+#define MICRO_OS_PLUS_INTEGER_SEMIHOSTING_STREAM_BUFFER_SIZE (1024)
+#endif // !defined(MICRO_OS_PLUS_INTEGER_SEMIHOSTING_STREAM_BUFFER_SIZE)
+
+// SYS_OPEN modes, as for fopen().
+#define AARCH64_SEMIHOSTING_OPEN_READ (0) // "r"
+#define AARCH64_SEMIHOSTING_OPEN_READ_BINARY (1) // "rb"
+#define AARCH64_SEMIHOSTING_OPEN_WRITE (4) // "w"
+#define AARCH64_SEMIHOSTING_OPEN_WRITE_BINARY (5) // "wb"
+#define AARCH64_SEMIHOSTING_OPEN_APPEND (8) // "a"
+#define AARCH64_SEMIHOSTING_OPEN_APPEND_BINARY (9) // "ab"
+
+// The special path of the host console.
+#define AARCH64_SEMIHOSTING_CONSOLE_PATH ":tt"
+
+// Stream flags.
+#define AARCH64_SEMIHOSTING_STREAM_OUTPUT (1U << 0)
+#define AARCH64_SEMIHOSTING_STREAM_LINE_BUFFERED (1U << 1)
+#define AARCH64_SEMIHOSTING_STREAM_EOF (1U << 2)
+#define AARCH64_SEMIHOSTING_STREAM_ERROR (1U << 3)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  /**
+   * A buffered semihosting stream.
+   *
+   * The `head` and `tail` indices run free and are masked with
+   * `size - 1` when accessing the buffer; `head - tail` is the number
+   * of buffered bytes.
+   */
+  typedef struct aarch64_architecture_semihosting_stream_s
+  {
+    micro_os_plus_semihosting_response_t handle; // -1 if closed.
+    uint8_t* buffer;
+    size_t size;
+    size_t head; // Producer index.
+    size_t tail; // Consumer index.
+    uint32_t flags;
+  } aarch64_architecture_semihosting_stream_t;
+
+  // --------------------------------------------------------------------------
+  // Buffered semihosting streams in C.
+
+  /**
+   * Open a host file, or the host console (`":tt"`), with one of the
+   * `AARCH64_SEMIHOSTING_OPEN_*` modes. Output streams to the console
+   * are line buffered.
+   *
+   * Return 0, or -1 if the file cannot be opened or the buffer size
+   * is not a power of 2.
+   */
+  int
+  aarch64_architecture_semihosting_stream_open (
+      aarch64_architecture_semihosting_stream_t* stream, const char* path,
+      uint32_t mode, void* buffer, size_t size);
+
+  /**
+   * Write bytes, flushing the buffer when full.
+   *
+   * Return the number of bytes written, or -1 on error.
+   */
+  ptrdiff_t
+  aarch64_architecture_semihosting_stream_write (
+      aarch64_architecture_semihosting_stream_t* stream, const void* data,
+      size_t count);
+
+  /**
+   * Write a null terminated string.
+   */
+  ptrdiff_t
+  aarch64_architecture_semihosting_stream_puts (
+      aarch64_architecture_semihosting_stream_t* stream, const char* str);
+
+  /**
+   * Write a single character; the fast path only stores it in the buffer.
+   *
+   * Return the character, or -1 on error.
+   */
+  static int
+  aarch64_architecture_semihosting_stream_putc (
+      aarch64_architecture_semihosting_stream_t* stream, int c);
+
+  /**
+   * Pass all buffered output to the host with one SYS_WRITE
+   * (two, if the content wraps around the end of the buffer).
+   *
+   * Return 0, or -1 on error.
+   */
+  int
+  aarch64_architecture_semihosting_stream_flush (
+      aarch64_architecture_semihosting_stream_t* stream);
+
+  /**
+   * Read bytes, refilling the buffer with one SYS_READ when empty.
+   * Requests larger than the buffer are read directly.
+   *
+   * Return the number of bytes read (0 at end of file), or -1 on error.
+   */
+  ptrdiff_t
+  aarch64_architecture_semihosting_stream_read (
+      aarch64_architecture_semihosting_stream_t* stream, void* data,
+      size_t count);
+
+  /**
+   * Read a single character.
+   *
+   * Return the character, or -1 at end of file or on error.
+   */
+  static int
+  aarch64_architecture_semihosting_stream_getc (
+      aarch64_architecture_semihosting_stream_t* stream);
+
+  /**
+   * Move to an absolute position; buffered output is flushed
+   * and buffered input is discarded.
+   *
+   * Return 0, or -1 on error.
+   */
+  int
+  aarch64_architecture_semihosting_stream_seek (
+      aarch64_architecture_semihosting_stream_t* stream, size_t position);
+
+  /**
+   * Return the length of the host file, or -1 on error.
+   */
+  ptrdiff_t
+  aarch64_architecture_semihosting_stream_length (
+      aarch64_architecture_semihosting_stream_t* stream);
+
+  /**
+   * Flush and close the stream.
+   *
+   * Return 0, or -1 on error.
+   */
+  int
+  aarch64_architecture_semihosting_stream_close (
+      aarch64_architecture_semihosting_stream_t* stream);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::semihosting
+{
+  // --------------------------------------------------------------------------
+  // Buffered semihosting streams in C++.
+
+  /**
+   * A buffered semihosting stream, with a statically allocated buffer.
+   * The destructor closes the stream.
+   */
+  template <size_t N = MICRO_OS_PLUS_INTEGER_SEMIHOSTING_STREAM_BUFFER_SIZE>
+  class stream
+  {
+    static_assert (N != 0 && (N & (N - 1)) == 0,
+                   "The buffer size must be a power of 2");
+
+  public:
+    stream ();
+
+    stream (const char* path, uint32_t mode);
+
+    stream (const stream&) = delete;
+    stream&
+    operator= (const stream&)
+        = delete;
+
+    ~stream ();
+
+    bool
+    open (const char* path, uint32_t mode);
+
+    bool
+    is_open (void) const;
+
+    ptrdiff_t
+    write (const void* data, size_t count);
+
+    ptrdiff_t
+    puts (const char* str);
+
+    int
+    putc (int c);
+
+    bool
+    flush (void);
+
+    ptrdiff_t
+    read (void* data, size_t count);
+
+    int
+    getc (void);
+
+    bool
+    seek (size_t position);
+
+    ptrdiff_t
+    length (void);
+
+    bool
+    close (void);
+
+  protected:
+    aarch64_architecture_semihosting_stream_t stream_;
+    uint8_t buffer_[N];
+  };
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::semihosting
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SEMIHOSTING_STREAMS_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,175 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SMP_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SMP_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/smp.h>
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the AArch64 multi-core support.
+
+#if defined(MICRO_OS_PLUS_USE_PSCI_SMC)
+#define AARCH64_PSCI_CONDUIT "smc"
+#else
+#define AARCH64_PSCI_CONDUIT "hvc"
+#endif // defined(MICRO_OS_PLUS_USE_PSCI_SMC)
+
+// MPIDR_EL1 fields.
+#define AARCH64_MPIDR_MT (1U << 24)
+#define AARCH64_MPIDR_AFFINITY_MASK (0xFF00FFFFFFULL)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) aarch64_architecture_register_t
+  aarch64_architecture_get_mpidr (void)
+  {
+    aarch64_architecture_register_t result;
+
+    __asm__ volatile(
+
+        " mrs %[result], mpidr_el1 "
+
+        : [result] "=r"(result) /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+
+    return result;
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  aarch64_architecture_get_core_id (void)
+  {
+    aarch64_architecture_register_t mpidr = aarch64_architecture_get_mpidr ();
+    if (mpidr & AARCH64_MPIDR_MT)
+      {
+        // Multi-threaded cores; Aff0 is the thread, use Aff1/Aff2.
+        mpidr >>= 8;
+      }
+
+    return (uint32_t)(((mpidr >> 8) & 0xFF)
+                          * MICRO_OS_PLUS_INTEGER_SMP_CORES_PER_CLUSTER
+                      + (mpidr & 0xFF));
+  }
+
+  static inline __attribute__ ((always_inline)) aarch64_architecture_register_t
+  aarch64_architecture_get_core_affinity (uint32_t core)
+  {
+    aarch64_architecture_register_t affinity
+        = ((aarch64_architecture_register_t)(
+               core / MICRO_OS_PLUS_INTEGER_SMP_CORES_PER_CLUSTER)
+           << 8)
+          | (core % MICRO_OS_PLUS_INTEGER_SMP_CORES_PER_CLUSTER);
+
+    // Assume all cores are of the same kind as the current one.
+    if (aarch64_architecture_get_mpidr () & AARCH64_MPIDR_MT)
+      {
+        affinity <<= 8;
+      }
+
+    return affinity;
+  }
+
+  static inline __attribute__ ((always_inline)) int64_t
+  aarch64_architecture_psci_call (uint32_t function, uint64_t arg1,
+                                  uint64_t arg2, uint64_t arg3)
+  {
+    register uint64_t x0 __asm__ ("x0") = function;
+    register uint64_t x1 __asm__ ("x1") = arg1;
+    register uint64_t x2 __asm__ ("x2") = arg2;
+    register uint64_t x3 __asm__ ("x3") = arg3;
+
+    // SMCCC v1.0 allows x4-x17 to be corrupted.
+    __asm__ volatile(
+
+        " " AARCH64_PSCI_CONDUIT " #0 \n"
+
+        : "+r"(x0), "+r"(x1), "+r"(x2), "+r"(x3) /* Outputs */
+        : /* Inputs */
+        : "x4", "x5", "x6", "x7", "x8", "x9", "x10", "x11", "x12", "x13",
+          "x14", "x15", "x16", "x17", "memory" /* Clobbers */
+    );
+
+    return (int64_t)x0;
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  micro_os_plus_architecture_get_core_id (void)
+  {
+    return aarch64_architecture_get_core_id ();
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::smp
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) uint32_t
+  core_id (void)
+  {
+    return aarch64_architecture_get_core_id ();
+  }
+
+  inline __attribute__ ((always_inline)) uint32_t
+  cores_count (void)
+  {
+    return aarch64_architecture_get_cores_count ();
+  }
+
+  inline __attribute__ ((always_inline)) int32_t
+  start_core (uint32_t core, entry_t entry, void* arg)
+  {
+    return aarch64_architecture_smp_start_core (core, entry, arg);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::smp
+
+namespace micro_os_plus::architecture
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) uint32_t
+  core_id (void)
+  {
+    return micro_os_plus_architecture_get_core_id ();
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::architecture
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SMP_INLINES_H_
+
+// ----------------------------------------------------------------------------
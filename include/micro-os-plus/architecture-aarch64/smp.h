@@ -0,0 +1,220 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SMP_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SMP_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/defines.h>
+
+// ----------------------------------------------------------------------------
+// Declarations of the AArch64 multi-core support.
+//
+// Core numbers are linear, computed from MPIDR_EL1 as
+// Aff1 * MICRO_OS_PLUS_INTEGER_SMP_CORES_PER_CLUSTER + Aff0
+// (the affinity fields are shifted if MPIDR_EL1.MT is set).
+// The per-core arrays have MICRO_OS_PLUS_INTEGER_SMP_MAX_CORES entries,
+// so all core numbers, including the one of the core that runs main(),
+// must be below it: with N clusters of CORES_PER_CLUSTER cores,
+// MAX_CORES must be at least N * CORES_PER_CLUSTER. The secondary
+// cores with larger numbers are turned off when started.
+//
+// Each core has its own stack, of `__stack_size` bytes, below `__stack`;
+// the linker script reserves `__cores_count` such stacks.
+//
+// Secondary cores are started via PSCI CPU_ON, with the HVC conduit,
+// or SMC if MICRO_OS_PLUS_USE_PSCI_SMC is defined. With
+// MICRO_OS_PLUS_INCLUDE_MMU, they enable the MMU and the caches with
+// the translation tables and registers of the core that started them,
+// before the first access to their stack, so all cores see the memory
+// as Normal and coherent.
+
+#if !defined(MICRO_OS_PLUS_INTEGER_SMP_CORES_PER_CLUSTER)
+#define MICRO_OS_PLUS_INTEGER_SMP_CORES_PER_CLUSTER (8)
+#endif
+
+#if !defined(MICRO_OS_PLUS_INTEGER_SMP_MAX_CORES)
+#define MICRO_OS_PLUS_INTEGER_SMP_MAX_CORES (8)
+#endif
+
+// PSCI function identifiers (ARM DEN 0022).
+#define AARCH64_PSCI_VERSION (0x84000000U)
+#define AARCH64_PSCI_CPU_OFF (0x84000002U)
+#define AARCH64_PSCI_CPU_ON (0xC4000003U)
+#define AARCH64_PSCI_AFFINITY_INFO (0xC4000004U)
+#define AARCH64_PSCI_SYSTEM_OFF (0x84000008U)
+#define AARCH64_PSCI_SYSTEM_RESET (0x84000009U)
+
+// PSCI return codes.
+#define AARCH64_PSCI_SUCCESS (0)
+#define AARCH64_PSCI_NOT_SUPPORTED (-1)
+#define AARCH64_PSCI_INVALID_PARAMETERS (-2)
+#define AARCH64_PSCI_DENIED (-3)
+#define AARCH64_PSCI_ALREADY_ON (-4)
+#define AARCH64_PSCI_ON_PENDING (-5)
+#define AARCH64_PSCI_INTERNAL_FAILURE (-6)
+
+// The start record of a secondary core, passed as the PSCI context
+// id; offsets used by smp-start.S.
+#define AARCH64_SMP_ENTRY_CORE (16)
+#define AARCH64_SMP_ENTRY_MAIR (24)
+#define AARCH64_SMP_ENTRY_TCR (32)
+#define AARCH64_SMP_ENTRY_TTBR0 (40)
+#define AARCH64_SMP_ENTRY_SCTLR (48)
+
+#if !defined(__ASSEMBLER__)
+
+#include <micro-os-plus/architecture-aarch64/types.h>
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  /**
+   * Type of the secondary cores entry points.
+   */
+  typedef void (*aarch64_architecture_smp_entry_t) (void* arg);
+
+  // --------------------------------------------------------------------------
+  // Multi-core support in C.
+
+  /**
+   * Multiprocessor Affinity Register getter (MPIDR_EL1).
+   */
+  static aarch64_architecture_register_t
+  aarch64_architecture_get_mpidr (void);
+
+  /**
+   * Linear number of the current core.
+   */
+  static uint32_t
+  aarch64_architecture_get_core_id (void);
+
+  /**
+   * Number of per-core stacks reserved by the linker script.
+   */
+  uint32_t
+  aarch64_architecture_get_cores_count (void);
+
+  /**
+   * MPIDR affinity value of a core, as expected by PSCI.
+   */
+  static aarch64_architecture_register_t
+  aarch64_architecture_get_core_affinity (uint32_t core);
+
+  /**
+   * Issue a PSCI call via HVC (or SMC); return x0.
+   */
+  static int64_t
+  aarch64_architecture_psci_call (uint32_t function, uint64_t arg1,
+                                  uint64_t arg2, uint64_t arg3);
+
+  /**
+   * Start a secondary core on `entry (arg)`, on its own stack, with
+   * the MMU and caches configured as on the calling core (off without
+   * MICRO_OS_PLUS_INCLUDE_MMU). If the entry returns, the core is
+   * powered off. Returns a PSCI code.
+   */
+  int32_t
+  aarch64_architecture_smp_start_core (uint32_t core,
+                                       aarch64_architecture_smp_entry_t entry,
+                                       void* arg);
+
+  /**
+   * Power off the current core; does not return.
+   */
+  void
+  aarch64_architecture_smp_stop_core (void) __attribute__ ((noreturn));
+
+  /**
+   * Reached from the secondary reset code, on the core stack.
+   */
+  void
+  aarch64_architecture_smp_secondary_main (uint32_t core)
+      __attribute__ ((noreturn));
+
+  // --------------------------------------------------------------------------
+  // Portable multi-core support in C.
+
+  /**
+   * Linear number of the current core.
+   */
+  static uint32_t
+  micro_os_plus_architecture_get_core_id (void);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::smp
+{
+  // --------------------------------------------------------------------------
+  // Multi-core support in C++.
+
+  using entry_t = aarch64_architecture_smp_entry_t;
+
+  /**
+   * Linear number of the current core.
+   */
+  uint32_t
+  core_id (void);
+
+  /**
+   * Number of cores with reserved stacks.
+   */
+  uint32_t
+  cores_count (void);
+
+  /**
+   * Start a secondary core; returns a PSCI code.
+   */
+  int32_t
+  start_core (uint32_t core, entry_t entry, void* arg = nullptr);
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::smp
+
+namespace micro_os_plus::architecture
+{
+  // --------------------------------------------------------------------------
+  // Portable multi-core support in C++.
+
+  /**
+   * Linear number of the current core.
+   */
+  uint32_t
+  core_id (void);
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::architecture
+
+#endif // defined(__cplusplus)
+
+#endif // !defined(__ASSEMBLER__)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SMP_H_
+
+// ----------------------------------------------------------------------------
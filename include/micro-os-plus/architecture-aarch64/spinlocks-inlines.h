@@ -0,0 +1,267 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SPINLOCKS_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SPINLOCKS_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/spinlocks.h>
+#include <micro-os-plus/architecture-aarch64/atomics-inlines.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the AArch64 spinlocks.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_ticket_lock_acquire (
+      aarch64_architecture_ticket_lock_t* lock)
+  {
+    uint32_t ticket;
+    uint32_t tmp;
+#if !defined(MICRO_OS_PLUS_USE_ATOMICS_LSE)
+    uint32_t status;
+#endif // !defined(MICRO_OS_PLUS_USE_ATOMICS_LSE)
+
+    // Take a ticket; if it is not served yet, sleep until the owner
+    // half-word is written by the release, then check again.
+    __asm__ volatile(
+
+#if defined(MICRO_OS_PLUS_USE_ATOMICS_LSE)
+        AARCH64_ATOMICS_LSE_PREAMBLE
+        " ldadda %w[increment], %w[ticket], %[mem] \n"
+#else
+        "1: \n"
+        " ldaxr %w[ticket], %[mem] \n"
+        " add %w[tmp], %w[ticket], %w[increment] \n"
+        " stxr %w[status], %w[tmp], %[mem] \n"
+        " cbnz %w[status], 1b \n"
+#endif // defined(MICRO_OS_PLUS_USE_ATOMICS_LSE)
+        " eor %w[tmp], %w[ticket], %w[ticket], ror #16 \n"
+        " cbz %w[tmp], 3f \n"
+        " sevl \n"
+        "2: \n"
+        " wfe \n"
+        " ldaxrh %w[tmp], %[mem] \n"
+        " eor %w[tmp], %w[tmp], %w[ticket], lsr #16 \n"
+        " cbnz %w[tmp], 2b \n"
+        "3: \n"
+
+        : [ticket] "=&r"(ticket), [tmp] "=&r"(tmp),
+#if !defined(MICRO_OS_PLUS_USE_ATOMICS_LSE)
+          [status] "=&r"(status),
+#endif // !defined(MICRO_OS_PLUS_USE_ATOMICS_LSE)
+          [mem] "+Q"(lock->value) /* Outputs */
+        : [increment] "r"(1U << 16) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) bool
+  aarch64_architecture_ticket_lock_try_acquire (
+      aarch64_architecture_ticket_lock_t* lock)
+  {
+    uint32_t value = lock->value;
+    if (((value >> 16) ^ value) & 0xFFFFU)
+      {
+        return false; // Busy.
+      }
+
+    return aarch64_architecture_atomic_compare_exchange_32 (
+               &lock->value, value, value + (1U << 16))
+           == value;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_ticket_lock_release (
+      aarch64_architecture_ticket_lock_t* lock)
+  {
+    uint32_t owner;
+
+    // Only the owner writes the low half-word, no atomic needed.
+    __asm__ volatile(
+
+        " ldrh %w[owner], %[mem] \n"
+        " add %w[owner], %w[owner], #1 \n"
+        " stlrh %w[owner], %[mem] \n"
+
+        : [owner] "=&r"(owner), [mem] "+Q"(lock->value) /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_mcs_lock_acquire (
+      aarch64_architecture_mcs_lock_t* lock,
+      aarch64_architecture_mcs_node_t* node)
+  {
+    node->next = NULL;
+    node->locked = 1;
+
+    aarch64_architecture_mcs_node_t* prev
+        = (aarch64_architecture_mcs_node_t*)(uintptr_t)
+            aarch64_architecture_atomic_swap_64 (
+                (volatile uint64_t*)(uintptr_t)&lock->tail,
+                (uint64_t)(uintptr_t)node);
+    if (prev == NULL)
+      {
+        return; // The lock was free.
+      }
+
+    uint32_t locked;
+
+    // Link behind the predecessor and sleep until it clears our flag.
+    __asm__ volatile(
+
+        " stlr %[node], %[next] \n"
+        " sevl \n"
+        "1: \n"
+        " wfe \n"
+        " ldaxr %w[locked], %[flag] \n"
+        " cbnz %w[locked], 1b \n"
+
+        : [locked] "=&r"(locked), [next] "=Q"(prev->next),
+          [flag] "+Q"(node->locked) /* Outputs */
+        : [node] "r"(node) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_mcs_lock_release (
+      aarch64_architecture_mcs_lock_t* lock,
+      aarch64_architecture_mcs_node_t* node)
+  {
+    aarch64_architecture_mcs_node_t* next;
+
+    __asm__ volatile(
+
+        " ldar %[next], %[mem] \n"
+
+        : [next] "=r"(next) /* Outputs */
+        : [mem] "Q"(node->next) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+
+    if (next == NULL)
+      {
+        // No known successor; try to mark the lock free.
+        if (aarch64_architecture_atomic_compare_exchange_64 (
+                (volatile uint64_t*)(uintptr_t)&lock->tail,
+                (uint64_t)(uintptr_t)node, 0)
+            == (uint64_t)(uintptr_t)node)
+          {
+            return;
+          }
+
+        // A successor is enqueueing; wait until it links itself.
+        __asm__ volatile(
+
+            " sevl \n"
+            "1: \n"
+            " wfe \n"
+            " ldaxr %[next], %[mem] \n"
+            " cbz %[next], 1b \n"
+
+            : [next] "=&r"(next), [mem] "+Q"(node->next) /* Outputs */
+            : /* Inputs */
+            : "memory" /* Clobbers */
+        );
+      }
+
+    __asm__ volatile(
+
+        " stlr wzr, %[mem] \n"
+
+        : [mem] "=Q"(next->locked) /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) void
+  ticket_lock::lock (void)
+  {
+    aarch64_architecture_ticket_lock_acquire (&lock_);
+  }
+
+  inline __attribute__ ((always_inline)) bool
+  ticket_lock::try_lock (void)
+  {
+    return aarch64_architecture_ticket_lock_try_acquire (&lock_);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  ticket_lock::unlock (void)
+  {
+    aarch64_architecture_ticket_lock_release (&lock_);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  mcs_lock::lock (node_t& node)
+  {
+    aarch64_architecture_mcs_lock_acquire (&lock_, &node);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  mcs_lock::unlock (node_t& node)
+  {
+    aarch64_architecture_mcs_lock_release (&lock_, &node);
+  }
+
+  inline __attribute__ ((always_inline))
+  mcs_lock::guard::guard (mcs_lock& lock)
+      : lock_{ lock }
+  {
+    lock_.lock (node_);
+  }
+
+  inline __attribute__ ((always_inline)) mcs_lock::guard::~guard ()
+  {
+    lock_.unlock (node_);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SPINLOCKS_INLINES_H_
+
+// ----------------------------------------------------------------------------
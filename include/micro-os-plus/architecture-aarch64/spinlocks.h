@@ -0,0 +1,216 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SPINLOCKS_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SPINLOCKS_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/atomics.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Declarations of the AArch64 spinlocks.
+//
+// Both locks are fair (FIFO) and the waiting cores sleep in `wfe`
+// until the lock word they monitor is written.
+// The locks do not mask interrupts; if a lock is also taken by
+// interrupt handlers, disable interrupts before acquiring it.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  /**
+   * Ticket lock; the current owner in the low 16 bits,
+   * the next ticket in the high 16 bits. Initialise to 0.
+   */
+  typedef struct aarch64_architecture_ticket_lock_s
+  {
+    volatile uint32_t value;
+  } aarch64_architecture_ticket_lock_t;
+
+  /**
+   * MCS queue node, one per waiting core, usually on the stack.
+   */
+  typedef struct aarch64_architecture_mcs_node_s
+  {
+    struct aarch64_architecture_mcs_node_s* volatile next;
+    volatile uint32_t locked;
+  } aarch64_architecture_mcs_node_t;
+
+  /**
+   * MCS queued lock; each core spins on its own node, so the lock
+   * cache line is written only once per acquisition. Initialise to 0.
+   */
+  typedef struct aarch64_architecture_mcs_lock_s
+  {
+    aarch64_architecture_mcs_node_t* volatile tail;
+  } aarch64_architecture_mcs_lock_t;
+
+  // --------------------------------------------------------------------------
+  // Spinlocks in C.
+
+  /**
+   * Take a ticket and wait for it to be served.
+   */
+  static void
+  aarch64_architecture_ticket_lock_acquire (
+      aarch64_architecture_ticket_lock_t* lock);
+
+  /**
+   * Acquire the lock only if it is free; return true if acquired.
+   */
+  static bool
+  aarch64_architecture_ticket_lock_try_acquire (
+      aarch64_architecture_ticket_lock_t* lock);
+
+  /**
+   * Serve the next ticket.
+   */
+  static void
+  aarch64_architecture_ticket_lock_release (
+      aarch64_architecture_ticket_lock_t* lock);
+
+  /**
+   * Enqueue the node and wait for the predecessor to hand over the lock.
+   */
+  static void
+  aarch64_architecture_mcs_lock_acquire (
+      aarch64_architecture_mcs_lock_t* lock,
+      aarch64_architecture_mcs_node_t* node);
+
+  /**
+   * Hand over the lock to the successor, if any.
+   */
+  static void
+  aarch64_architecture_mcs_lock_release (
+      aarch64_architecture_mcs_lock_t* lock,
+      aarch64_architecture_mcs_node_t* node);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture
+{
+  // --------------------------------------------------------------------------
+  // Spinlocks in C++.
+
+  /**
+   * Ticket lock, usable with `std::lock_guard<>`.
+   */
+  class ticket_lock
+  {
+  public:
+    constexpr ticket_lock () = default;
+
+    ticket_lock (const ticket_lock&) = delete;
+    ticket_lock (ticket_lock&&) = delete;
+    ticket_lock&
+    operator= (const ticket_lock&)
+        = delete;
+    ticket_lock&
+    operator= (ticket_lock&&)
+        = delete;
+
+    ~ticket_lock () = default;
+
+    void
+    lock (void);
+
+    bool
+    try_lock (void);
+
+    void
+    unlock (void);
+
+  protected:
+    aarch64_architecture_ticket_lock_t lock_{};
+  };
+
+  /**
+   * MCS queued lock; the queue node is provided by the caller.
+   */
+  class mcs_lock
+  {
+  public:
+    using node_t = aarch64_architecture_mcs_node_t;
+
+    /**
+     * Scoped ownership, with the queue node allocated on the stack.
+     */
+    class guard
+    {
+    public:
+      explicit guard (mcs_lock& lock);
+
+      guard (const guard&) = delete;
+      guard (guard&&) = delete;
+      guard&
+      operator= (const guard&)
+          = delete;
+      guard&
+      operator= (guard&&)
+          = delete;
+
+      ~guard ();
+
+    protected:
+      mcs_lock& lock_;
+      node_t node_;
+    };
+
+    constexpr mcs_lock () = default;
+
+    mcs_lock (const mcs_lock&) = delete;
+    mcs_lock (mcs_lock&&) = delete;
+    mcs_lock&
+    operator= (const mcs_lock&)
+        = delete;
+    mcs_lock&
+    operator= (mcs_lock&&)
+        = delete;
+
+    ~mcs_lock () = default;
+
+    void
+    lock (node_t& node);
+
+    void
+    unlock (node_t& node);
+
+  protected:
+    aarch64_architecture_mcs_lock_t lock_{};
+  };
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SPINLOCKS_H_
+
+// ----------------------------------------------------------------------------
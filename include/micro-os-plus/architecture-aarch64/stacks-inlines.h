@@ -0,0 +1,140 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_STACKS_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_STACKS_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/stacks.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the AArch64 stack usage functions.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) size_t
+  aarch64_architecture_stack_get_high_water (const void* begin,
+                                             const void* end)
+  {
+    return (size_t)((const uint8_t*)end - (const uint8_t*)begin)
+           - aarch64_architecture_stack_get_unused (begin, end);
+  }
+
+#if defined(MICRO_OS_PLUS_HAS_INTERRUPTS_STACK)
+
+  static inline __attribute__ ((always_inline))
+  aarch64_architecture_register_t
+  aarch64_architecture_get_spsel (void)
+  {
+    aarch64_architecture_register_t value;
+
+    __asm__ volatile(
+
+        " mrs %[value], spsel "
+
+        : [value] "=r"(value) /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+
+    return value;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_interrupts_stack_switch (void* top)
+  {
+    aarch64_architecture_register_t sp;
+
+    // The compiler sees no change, the code continues with the
+    // same stack pointer value, now in SP_EL0.
+    __asm__ volatile(
+
+        " mov %[sp], sp \n"
+        " msr sp_el0, %[sp] \n"
+        " mov sp, %[top] \n"
+        " msr spsel, #0 \n"
+
+        : [sp] "=&r"(sp) /* Outputs */
+        : [top] "r"(top) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+#endif // defined(MICRO_OS_PLUS_HAS_INTERRUPTS_STACK)
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::stack
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) void
+  fill (void* begin, void* end)
+  {
+    aarch64_architecture_stack_fill (begin, end);
+  }
+
+  inline __attribute__ ((always_inline)) size_t
+  unused (const void* begin, const void* end)
+  {
+    return aarch64_architecture_stack_get_unused (begin, end);
+  }
+
+  inline __attribute__ ((always_inline)) size_t
+  high_water (const void* begin, const void* end)
+  {
+    return aarch64_architecture_stack_get_high_water (begin, end);
+  }
+
+#if defined(MICRO_OS_PLUS_HAS_INTERRUPTS_STACK)
+
+  inline __attribute__ ((always_inline)) bool
+  interrupts_install (void)
+  {
+    return aarch64_architecture_interrupts_stack_install ();
+  }
+
+  inline __attribute__ ((always_inline)) size_t
+  interrupts_high_water (uint32_t core)
+  {
+    return aarch64_architecture_interrupts_stack_get_high_water (core);
+  }
+
+#endif // defined(MICRO_OS_PLUS_HAS_INTERRUPTS_STACK)
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::stack
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_STACKS_INLINES_H_
+
+// ----------------------------------------------------------------------------
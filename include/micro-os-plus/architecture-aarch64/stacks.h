@@ -0,0 +1,169 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_STACKS_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_STACKS_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/defines.h>
+#include <micro-os-plus/architecture-aarch64/types.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Declarations of the AArch64 stack usage functions and of the
+// interrupts stack.
+//
+// The stacks are filled with MICRO_OS_PLUS_INTEGER_STARTUP_STACK_FILL_MAGIC
+// when created; later, the part still holding the magic, from the
+// bottom up, was never used. Filling uses 64-byte SIMD stores, the
+// scan compares 64 bytes at a time with ASIMD, so both can run often,
+// even on large stacks. The regions must be 8 bytes aligned, and the
+// result has an 8 bytes granularity.
+//
+// With MICRO_OS_PLUS_HAS_INTERRUPTS_STACK, the interrupt handlers run
+// on a per-core stack reserved by the linker script (SP_EL1), while the
+// threads use SP_EL0; the thread stacks do not have to reserve room for
+// the nested interrupts. The RTOS must create the thread frames with
+// SPSR_EL1.M set to EL1t.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+  // Stack usage in C.
+
+  /**
+   * Fill the stack region with the magic pattern.
+   */
+  void
+  aarch64_architecture_stack_fill (void* begin, void* end);
+
+  /**
+   * The number of bytes, from the bottom of the region, still holding
+   * the magic pattern.
+   */
+  size_t
+  aarch64_architecture_stack_get_unused (const void* begin, const void* end);
+
+  /**
+   * The maximum number of bytes used since the region was filled.
+   */
+  static size_t
+  aarch64_architecture_stack_get_high_water (const void* begin,
+                                             const void* end);
+
+#if defined(MICRO_OS_PLUS_HAS_INTERRUPTS_STACK)
+
+  /**
+   * Stack Pointer Select getter (SPSel); 1 when running on SP_EL1.
+   */
+  static aarch64_architecture_register_t
+  aarch64_architecture_get_spsel (void);
+
+  /**
+   * Copy the current stack pointer to SP_EL0 and continue on it, then
+   * move SP_EL1 to `top`. To be called on SP_EL1, with IRQs masked.
+   */
+  static void
+  aarch64_architecture_interrupts_stack_switch (void* top);
+
+  /**
+   * The region of the interrupts stack of a core.
+   */
+  void*
+  aarch64_architecture_interrupts_stack_get_begin (uint32_t core);
+
+  void*
+  aarch64_architecture_interrupts_stack_get_end (uint32_t core);
+
+  /**
+   * Fill the interrupts stack of the current core and switch to it;
+   * the current stack continues as the thread stack, on SP_EL0.
+   * To be called once on each core, before enabling interrupts.
+   * Return false if the linker script did not reserve it.
+   */
+  bool
+  aarch64_architecture_interrupts_stack_install (void);
+
+  /**
+   * The maximum number of bytes used on the interrupts stack of a core.
+   */
+  size_t
+  aarch64_architecture_interrupts_stack_get_high_water (uint32_t core);
+
+#endif // defined(MICRO_OS_PLUS_HAS_INTERRUPTS_STACK)
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::stack
+{
+  // --------------------------------------------------------------------------
+  // Stack usage in C++.
+
+  /**
+   * Fill the region with the magic pattern.
+   */
+  void
+  fill (void* begin, void* end);
+
+  /**
+   * The bytes never used, from the bottom of the region.
+   */
+  size_t
+  unused (const void* begin, const void* end);
+
+  /**
+   * The maximum number of bytes used.
+   */
+  size_t
+  high_water (const void* begin, const void* end);
+
+#if defined(MICRO_OS_PLUS_HAS_INTERRUPTS_STACK)
+
+  /**
+   * Switch the current core to its interrupts stack.
+   */
+  bool
+  interrupts_install (void);
+
+  /**
+   * The maximum number of bytes used on the interrupts stack.
+   */
+  size_t
+  interrupts_high_water (uint32_t core);
+
+#endif // defined(MICRO_OS_PLUS_HAS_INTERRUPTS_STACK)
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::stack
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_STACKS_H_
+
+// ----------------------------------------------------------------------------
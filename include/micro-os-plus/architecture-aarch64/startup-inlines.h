@@ -0,0 +1,115 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_STARTUP_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_STARTUP_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/startup.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the AArch64 startup memory initialisation.
+
+// DCZID_EL0 fields.
+#define AARCH64_DCZID_BS_MASK (0xFU)
+#define AARCH64_DCZID_DZP (1U << 4)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) aarch64_architecture_register_t
+  aarch64_architecture_get_dczid (void)
+  {
+    aarch64_architecture_register_t result;
+
+    __asm__ volatile(
+
+        " mrs %[result], dczid_el0 "
+
+        : [result] "=r"(result) /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+
+    return result;
+  }
+
+  static inline __attribute__ ((always_inline)) size_t
+  aarch64_architecture_get_dc_zva_block_size (void)
+  {
+    aarch64_architecture_register_t dczid = aarch64_architecture_get_dczid ();
+    if (dczid & AARCH64_DCZID_DZP)
+      {
+        return 0;
+      }
+
+    // The field is log2 of the number of 4-byte words.
+    return (size_t)4 << (dczid & AARCH64_DCZID_BS_MASK);
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::startup
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) size_t
+  dc_zva_block_size (void)
+  {
+    return aarch64_architecture_get_dc_zva_block_size ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  copy_data (const uint32_t* from, uint32_t* region_begin,
+             uint32_t* region_end)
+  {
+    aarch64_architecture_startup_copy_data (from, region_begin, region_end);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  clear_bss (uint32_t* region_begin, uint32_t* region_end)
+  {
+    aarch64_architecture_startup_clear_bss (region_begin, region_end);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  initialize_memory (void)
+  {
+    aarch64_architecture_startup_initialize_memory ();
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::startup
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_STARTUP_INLINES_H_
+
+// ----------------------------------------------------------------------------
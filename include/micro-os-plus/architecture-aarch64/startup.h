@@ -0,0 +1,131 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_STARTUP_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_STARTUP_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/defines.h>
+#include <micro-os-plus/architecture-aarch64/types.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Declarations of the AArch64 startup memory initialisation.
+//
+// The `.data` regions are copied with 64-byte LDP/STP blocks and
+// the `.bss` regions are cleared with `dc zva`, at the block size
+// reported by DCZID_EL0, or with 64-byte STP blocks.
+//
+// The routines also run with the MMU off, when all memory is Device
+// and unaligned accesses and `dc zva` fault; they fall back to aligned
+// accesses only, which is slower. For best results, enable the MMU
+// first (see aarch64_architecture_mmu_initialize()).
+//
+// The regions must be word aligned, as required by the linker script.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+  // Startup memory initialisation in C.
+
+  /**
+   * Data Cache Zero ID Register getter (DCZID_EL0).
+   */
+  static aarch64_architecture_register_t
+  aarch64_architecture_get_dczid (void);
+
+  /**
+   * Size of the block cleared by `dc zva`, in bytes,
+   * or 0 if the instruction is prohibited.
+   */
+  static size_t
+  aarch64_architecture_get_dc_zva_block_size (void);
+
+  /**
+   * Copy the initial values of a `.data` region.
+   */
+  void
+  aarch64_architecture_startup_copy_data (const uint32_t* from,
+                                          uint32_t* region_begin,
+                                          uint32_t* region_end);
+
+  /**
+   * Clear a `.bss` region.
+   */
+  void
+  aarch64_architecture_startup_clear_bss (uint32_t* region_begin,
+                                          uint32_t* region_end);
+
+  /**
+   * Initialise all regions described by the `__data_regions_array_*`
+   * and `__bss_regions_array_*` tables in the linker script.
+   * To be called by the startup code, instead of its own loops.
+   */
+  void
+  aarch64_architecture_startup_initialize_memory (void);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::startup
+{
+  // --------------------------------------------------------------------------
+  // Startup memory initialisation in C++.
+
+  /**
+   * Size of the `dc zva` block, or 0 if prohibited.
+   */
+  size_t
+  dc_zva_block_size (void);
+
+  /**
+   * Copy the initial values of a `.data` region.
+   */
+  void
+  copy_data (const uint32_t* from, uint32_t* region_begin,
+             uint32_t* region_end);
+
+  /**
+   * Clear a `.bss` region.
+   */
+  void
+  clear_bss (uint32_t* region_begin, uint32_t* region_end);
+
+  /**
+   * Initialise all `.data` and `.bss` regions.
+   */
+  void
+  initialize_memory (void);
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::startup
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_STARTUP_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,259 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SYSCALLS_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SYSCALLS_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/syscalls.h>
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the AArch64 system calls.
+
+// The registers the handlers may change, besides x0-x5 (and x8).
+#if defined(__ARM_FP)
+#define AARCH64_SYSCALL_CLOBBERS                                              \
+  "x6", "x7", "x9", "x10", "x11", "x12", "x13", "x14", "x15", "x16", "x17",  \
+      "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7", "v16", "v17", "v18",    \
+      "v19", "v20", "v21", "v22", "v23", "v24", "v25", "v26", "v27", "v28",   \
+      "v29", "v30", "v31", "cc", "memory"
+#else
+#define AARCH64_SYSCALL_CLOBBERS                                              \
+  "x6", "x7", "x9", "x10", "x11", "x12", "x13", "x14", "x15", "x16", "x17",  \
+      "cc", "memory"
+#endif // defined(__ARM_FP)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+  // System calls in C.
+
+  static inline __attribute__ ((always_inline)) int64_t
+  aarch64_architecture_syscall (uint64_t number, uint64_t a0, uint64_t a1,
+                                uint64_t a2, uint64_t a3, uint64_t a4,
+                                uint64_t a5)
+  {
+    register uint64_t x0 __asm__ ("x0") = a0;
+    register uint64_t x1 __asm__ ("x1") = a1;
+    register uint64_t x2 __asm__ ("x2") = a2;
+    register uint64_t x3 __asm__ ("x3") = a3;
+    register uint64_t x4 __asm__ ("x4") = a4;
+    register uint64_t x5 __asm__ ("x5") = a5;
+    register uint64_t x8 __asm__ ("x8") = number;
+
+    __asm__ volatile(
+
+        " svc #0 \n"
+
+        : "+r"(x0), "+r"(x1), "+r"(x2), "+r"(x3), "+r"(x4), "+r"(x5),
+          "+r"(x8) /* Outputs */
+        : /* Inputs */
+        : AARCH64_SYSCALL_CLOBBERS /* Clobbers */
+    );
+
+    return (int64_t)x0;
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::syscalls
+{
+  // --------------------------------------------------------------------------
+
+  // Not constexpr; calling it stops the compile time evaluation.
+  void
+  invalid_or_duplicate_syscall_number (void);
+
+  consteval table_t
+  make_table (std::initializer_list<entry> entries)
+  {
+    table_t table{};
+    for (const entry& e : entries)
+      {
+        if (e.number >= count || e.handler == nullptr
+            || table.handlers[e.number] != nullptr)
+          {
+            invalid_or_duplicate_syscall_number ();
+          }
+        table.handlers[e.number] = e.handler;
+      }
+    return table;
+  }
+
+  template <typename T>
+  constexpr uint64_t
+  to_register (T value)
+  {
+    static_assert (std::is_integral_v<T> || std::is_enum_v<T>
+                       || std::is_pointer_v<T>,
+                   "Only integers and pointers are passed in registers");
+    if constexpr (std::is_pointer_v<T>)
+      {
+        return reinterpret_cast<uintptr_t> (value);
+      }
+    else
+      {
+        // Signed values are sign extended.
+        return static_cast<uint64_t> (value);
+      }
+  }
+
+  template <typename T>
+  constexpr T
+  from_register (uint64_t value)
+  {
+    if constexpr (std::is_pointer_v<T>)
+      {
+        return reinterpret_cast<T> (static_cast<uintptr_t> (value));
+      }
+    else
+      {
+        return static_cast<T> (value);
+      }
+  }
+
+  template <typename F>
+  struct signature;
+
+  template <typename R, typename... Args>
+  struct signature<R (*) (Args...)>
+  {
+    static_assert (sizeof...(Args) <= 6, "Up to 6 arguments");
+
+    using result = R;
+    using arguments = std::tuple<Args...>;
+  };
+
+  template <typename R, typename... Args>
+  struct signature<R (*) (Args...) noexcept> : signature<R (*) (Args...)>
+  {
+  };
+
+  template <auto Function>
+  struct adapter
+  {
+    using result = typename signature<decltype (Function)>::result;
+    using arguments = typename signature<decltype (Function)>::arguments;
+
+    static constexpr size_t arity = std::tuple_size_v<arguments>;
+
+    template <size_t... I>
+    static int64_t
+    invoke (const uint64_t* a, std::index_sequence<I...>)
+    {
+      if constexpr (std::is_void_v<result>)
+        {
+          Function (
+              from_register<std::tuple_element_t<I, arguments>> (a[I])...);
+          return 0;
+        }
+      else
+        {
+          return static_cast<int64_t> (to_register (Function (
+              from_register<std::tuple_element_t<I, arguments>> (a[I])...)));
+        }
+    }
+  };
+
+  template <auto Function>
+  int64_t
+  handler (uint64_t a0, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4,
+           uint64_t a5)
+  {
+    const uint64_t a[6] = { a0, a1, a2, a3, a4, a5 };
+    return adapter<Function>::invoke (
+        a, std::make_index_sequence<adapter<Function>::arity> ());
+  }
+
+  template <uint16_t Number, typename... Args>
+  inline __attribute__ ((always_inline)) int64_t
+  call (Args... args)
+  {
+    static_assert (Number != 0, "Use call (number, args...) for x8");
+    static_assert (sizeof...(Args) <= 6, "Up to 6 arguments");
+
+    const uint64_t a[6] = { to_register (args)... };
+    register uint64_t x0 __asm__ ("x0") = a[0];
+    register uint64_t x1 __asm__ ("x1") = a[1];
+    register uint64_t x2 __asm__ ("x2") = a[2];
+    register uint64_t x3 __asm__ ("x3") = a[3];
+    register uint64_t x4 __asm__ ("x4") = a[4];
+    register uint64_t x5 __asm__ ("x5") = a[5];
+
+    __asm__ volatile(
+
+        " svc %[number] \n"
+
+        : "+r"(x0), "+r"(x1), "+r"(x2), "+r"(x3), "+r"(x4),
+          "+r"(x5) /* Outputs */
+        : [number] "n"(Number) /* Inputs */
+        : "x8", AARCH64_SYSCALL_CLOBBERS /* Clobbers */
+    );
+
+    return static_cast<int64_t> (x0);
+  }
+
+  template <typename... Args>
+  inline __attribute__ ((always_inline)) int64_t
+  call (uint32_t number, Args... args)
+  {
+    static_assert (sizeof...(Args) <= 6, "Up to 6 arguments");
+
+    const uint64_t a[6] = { to_register (args)... };
+    return aarch64_architecture_syscall (number, a[0], a[1], a[2], a[3],
+                                         a[4], a[5]);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::syscalls
+
+namespace micro_os_plus::architecture
+{
+  // --------------------------------------------------------------------------
+
+  template <typename... Args>
+  inline __attribute__ ((always_inline)) int64_t
+  syscall (uint32_t number, Args... args)
+  {
+    return aarch64::architecture::syscalls::call (number, args...);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::architecture
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SYSCALLS_INLINES_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,178 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SYSCALLS_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SYSCALLS_H_
+
+// ----------------------------------------------------------------------------
+// Definitions shared by the system call gate (exception-vectors.S)
+// and the C/C++ code.
+//
+// When MICRO_OS_PLUS_INCLUDE_SYSCALLS is defined, the synchronous
+// exception vectors from EL0 and from EL1 check ESR_EL1 first; an SVC
+// does not save a frame, it calls the handler from
+// aarch64_architecture_syscalls_table directly and returns with `eret`.
+//
+// The number is the `svc` immediate or, for `svc #0`, x8. The
+// arguments are in x0-x5 and the result in x0; x1-x17 and the SIMD/FP
+// caller-saved registers are not preserved, as for a function call;
+// when returning to EL0 they are cleared, so the values left by the
+// handlers do not leak to the application. The handlers run on
+// SP_EL1, with the IRQs masked. Unknown numbers return
+// AARCH64_SYSCALL_NOT_IMPLEMENTED.
+
+// The number of entries in the system call table.
+#if !defined(MICRO_OS_PLUS_INTEGER_SYSCALLS_COUNT)
+#define MICRO_OS_PLUS_INTEGER_SYSCALLS_COUNT (64)
+#endif // !defined(MICRO_OS_PLUS_INTEGER_SYSCALLS_COUNT)
+
+// ESR_EL1 exception class of the SVC instruction in AArch64.
+#define AARCH64_ESR_EC_SHIFT (26)
+#define AARCH64_ESR_EC_SVC64 (0x15)
+
+// The result of unknown system calls (-ENOSYS).
+#define AARCH64_SYSCALL_NOT_IMPLEMENTED (-38)
+
+#if !defined(__ASSEMBLER__)
+
+#include <micro-os-plus/architecture-aarch64/types.h>
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+#include <cstddef>
+#include <initializer_list>
+#endif // defined(__cplusplus)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  typedef int64_t (*aarch64_architecture_syscall_handler_t) (
+      uint64_t a0, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4,
+      uint64_t a5);
+
+  /**
+   * The system call handlers, indexed by number; null entries are
+   * not implemented.
+   */
+  typedef struct aarch64_architecture_syscalls_table_s
+  {
+    aarch64_architecture_syscall_handler_t
+        handlers[MICRO_OS_PLUS_INTEGER_SYSCALLS_COUNT];
+  } aarch64_architecture_syscalls_table_t;
+
+  /**
+   * The table used by the gate; weak, all null, to be redefined by
+   * the kernel, usually with `syscalls::make_table()`.
+   */
+  extern const aarch64_architecture_syscalls_table_t
+      aarch64_architecture_syscalls_table;
+
+  // --------------------------------------------------------------------------
+  // System calls in C.
+
+  /**
+   * Call the system call `number`, passed in x8, with `svc #0`.
+   */
+  static int64_t
+  aarch64_architecture_syscall (uint64_t number, uint64_t a0, uint64_t a1,
+                                uint64_t a2, uint64_t a3, uint64_t a4,
+                                uint64_t a5);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::syscalls
+{
+  // --------------------------------------------------------------------------
+  // System calls in C++.
+
+  using handler_t = aarch64_architecture_syscall_handler_t;
+  using table_t = aarch64_architecture_syscalls_table_t;
+
+  constexpr uint32_t count = MICRO_OS_PLUS_INTEGER_SYSCALLS_COUNT;
+
+  struct entry
+  {
+    uint32_t number;
+    handler_t handler;
+  };
+
+  /**
+   * The table, built at compile time; duplicate or out of range
+   * numbers do not compile.
+   */
+  consteval table_t
+  make_table (std::initializer_list<entry> entries);
+
+  /**
+   * Adapt a function with up to 6 integer or pointer parameters,
+   * returning an integer, a pointer or void, to `handler_t`.
+   */
+  template <auto Function>
+  int64_t
+  handler (uint64_t a0, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4,
+           uint64_t a5);
+
+  /**
+   * Call the system call `Number` (1-65535) with `svc #Number`,
+   * with integer or pointer arguments.
+   */
+  template <uint16_t Number, typename... Args>
+  int64_t
+  call (Args... args);
+
+  /**
+   * Call the system call `number`, passed in x8, with `svc #0`.
+   */
+  template <typename... Args>
+  int64_t
+  call (uint32_t number, Args... args);
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::syscalls
+
+namespace micro_os_plus::architecture
+{
+  // --------------------------------------------------------------------------
+  // Portable system calls in C++.
+
+  /**
+   * Call the kernel service `number` from an unprivileged thread.
+   */
+  template <typename... Args>
+  int64_t
+  syscall (uint32_t number, Args... args);
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::architecture
+
+#endif // defined(__cplusplus)
+
+#endif // !defined(__ASSEMBLER__)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_SYSCALLS_H_
+
+// ----------------------------------------------------------------------------
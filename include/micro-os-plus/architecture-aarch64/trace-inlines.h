@@ -0,0 +1,164 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_TRACE_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_TRACE_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/trace.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the AArch64 event tracer.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+  // Event tracer in C.
+
+  static inline __attribute__ ((always_inline)) void
+  aarch64_architecture_trace_event (uint32_t event, uint64_t arg0,
+                                    uint64_t arg1)
+  {
+#if defined(MICRO_OS_PLUS_INCLUDE_TRACE)
+    if (aarch64_architecture_trace_enabled == 0)
+      {
+        return;
+      }
+
+    uint32_t core = aarch64_architecture_get_core_id ();
+    if (core >= MICRO_OS_PLUS_INTEGER_SMP_MAX_CORES)
+      {
+        return;
+      }
+
+    aarch64_architecture_trace_ring_t* ring
+        = &aarch64_architecture_trace_buffer.rings[core];
+    uint64_t index
+        = aarch64_architecture_atomic_fetch_add_64 (&ring->total, 1);
+    aarch64_architecture_trace_record_t* record
+        = &ring->records[index & (MICRO_OS_PLUS_INTEGER_TRACE_RECORDS - 1)];
+
+    uint64_t timestamp;
+    // Without `isb`; a few cycles of skew are acceptable here.
+    __asm__ volatile(
+
+        " mrs %[timestamp], " AARCH64_GENERIC_TIMER_COUNTER " \n"
+
+        : [timestamp] "=r"(timestamp) /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+
+    record->timestamp = timestamp;
+    record->core = core;
+    record->event = event;
+    record->arg0 = arg0;
+    record->arg1 = arg1;
+#else
+    (void)event;
+    (void)arg0;
+    (void)arg1;
+#endif // defined(MICRO_OS_PLUS_INCLUDE_TRACE)
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::trace
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) bool
+  initialize (void)
+  {
+    return aarch64_architecture_trace_initialize ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  start (void)
+  {
+    aarch64_architecture_trace_start ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  stop (void)
+  {
+    aarch64_architecture_trace_stop ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  event (uint32_t id, uint64_t arg0, uint64_t arg1)
+  {
+    aarch64_architecture_trace_event (id, arg0, arg1);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  flush (void)
+  {
+    aarch64_architecture_trace_flush ();
+  }
+
+  inline __attribute__ ((always_inline)) bool
+  is_recovered (void)
+  {
+    return aarch64_architecture_trace_is_recovered ();
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  sequence (void)
+  {
+    return aarch64_architecture_trace_get_sequence ();
+  }
+
+  inline __attribute__ ((always_inline)) size_t
+  count (uint32_t core)
+  {
+    return aarch64_architecture_trace_get_count (core);
+  }
+
+  inline __attribute__ ((always_inline)) const record*
+  get (uint32_t core, size_t index)
+  {
+    return aarch64_architecture_trace_get_record (core, index);
+  }
+
+  inline __attribute__ ((always_inline)) bool
+  write (const char* path)
+  {
+    return aarch64_architecture_trace_write (path) == 0;
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::trace
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_TRACE_INLINES_H_
+
+// ----------------------------------------------------------------------------
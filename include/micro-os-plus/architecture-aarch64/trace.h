@@ -0,0 +1,292 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_TRACE_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_TRACE_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-aarch64/defines.h>
+#include <micro-os-plus/architecture-aarch64/types.h>
+#include <micro-os-plus/architecture-aarch64/cache.h>
+#include <micro-os-plus/architecture-aarch64/smp.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Declarations of the AArch64 binary event tracer.
+//
+// Each trace point writes a 32 bytes record, with the generic timer
+// counter, the core, the event and two arguments, in the ring of the
+// current core; the slot is taken with an atomic add on the ring
+// counter, so the interrupt handlers may also trace, and no lock is
+// needed. When the ring is full, the oldest records are overwritten.
+//
+// The rings are in `.noinit`, which the startup does not clear; a
+// header with a magic number, the layout and the sequence number of
+// the run identifies them after a warm reset (for example by the
+// watchdog). `aarch64_architecture_trace_initialize()` keeps the
+// surviving rings and does not start the tracing, so they can be
+// written to the host first, with the semihosting file I/O.
+//
+// The data cache is not written back by a reset; for the last records
+// to survive, call `aarch64_architecture_trace_flush()` from the fatal
+// error handlers or from the watchdog early warning interrupt.
+//
+// The file, little endian, has an `aarch64_architecture_trace_file_t`
+// header, then, for each core, an `aarch64_architecture_trace_file_ring_t`
+// followed by `count` records, the oldest first. The records of the
+// interrupt handlers may precede those of the code they interrupted,
+// sort them by timestamp if needed.
+
+// The number of records in the ring of each core; a power of 2.
+#if !defined(MICRO_OS_PLUS_INTEGER_TRACE_RECORDS)
+#define MICRO_OS_PLUS_INTEGER_TRACE_RECORDS (1024)
+#endif // !defined(MICRO_OS_PLUS_INTEGER_TRACE_RECORDS)
+
+// "uOStrace", in memory and at the beginning of the file.
+#define AARCH64_TRACE_MAGIC (0x6563617274534F75ULL)
+
+#define AARCH64_TRACE_FILE_VERSION (1)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  /**
+   * A trace record.
+   */
+  typedef struct aarch64_architecture_trace_record_s
+  {
+    // The generic timer counter.
+    uint64_t timestamp;
+    uint32_t core;
+    uint32_t event;
+    uint64_t arg0;
+    uint64_t arg1;
+  } aarch64_architecture_trace_record_t;
+
+  /**
+   * The records of one core.
+   */
+  typedef struct aarch64_architecture_trace_ring_s
+  {
+    // The records written since the start; the next one goes to
+    // `total % MICRO_OS_PLUS_INTEGER_TRACE_RECORDS`.
+    __attribute__ ((aligned (MICRO_OS_PLUS_INTEGER_CACHE_LINE_SIZE)))
+    volatile uint64_t total;
+
+    __attribute__ ((aligned (MICRO_OS_PLUS_INTEGER_CACHE_LINE_SIZE)))
+    aarch64_architecture_trace_record_t
+        records[MICRO_OS_PLUS_INTEGER_TRACE_RECORDS];
+  } aarch64_architecture_trace_ring_t;
+
+  /**
+   * The buffer in `.noinit`.
+   */
+  typedef struct aarch64_architecture_trace_buffer_s
+  {
+    uint64_t magic;
+    uint64_t sequence;
+    // The complement of the sequence.
+    uint64_t check;
+    uint32_t cores;
+    uint32_t records;
+
+    aarch64_architecture_trace_ring_t
+        rings[MICRO_OS_PLUS_INTEGER_SMP_MAX_CORES];
+  } aarch64_architecture_trace_buffer_t;
+
+  /**
+   * The file header.
+   */
+  typedef struct aarch64_architecture_trace_file_s
+  {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t record_size;
+    uint32_t cores;
+    uint32_t records;
+    uint64_t sequence;
+    // The counter frequency, in Hz.
+    uint64_t frequency;
+    // 1 if the rings survived a reset.
+    uint32_t recovered;
+    uint32_t reserved;
+  } aarch64_architecture_trace_file_t;
+
+  /**
+   * The header of each ring in the file.
+   */
+  typedef struct aarch64_architecture_trace_file_ring_s
+  {
+    uint32_t core;
+    // The records that follow.
+    uint32_t count;
+    // The records written since the start, including the overwritten
+    // ones.
+    uint64_t total;
+  } aarch64_architecture_trace_file_ring_t;
+
+  extern aarch64_architecture_trace_buffer_t aarch64_architecture_trace_buffer;
+
+  // Not in `.noinit`, so the trace points do nothing until the
+  // tracing is started.
+  extern volatile uint32_t aarch64_architecture_trace_enabled;
+
+  // --------------------------------------------------------------------------
+  // Event tracer in C.
+
+  /**
+   * Check the rings left in `.noinit`. To be called once, early, before
+   * the other cores start. If they survived a reset, keep them and
+   * return true; the tracing remains stopped until
+   * `aarch64_architecture_trace_start()`. Otherwise start the tracing
+   * and return false.
+   */
+  bool
+  aarch64_architecture_trace_initialize (void);
+
+  /**
+   * Clear the rings, increment the sequence number and enable the
+   * trace points.
+   */
+  void
+  aarch64_architecture_trace_start (void);
+
+  /**
+   * Disable the trace points; the rings are kept.
+   */
+  void
+  aarch64_architecture_trace_stop (void);
+
+  /**
+   * Write a record in the ring of the current core, if enabled.
+   */
+  static void
+  aarch64_architecture_trace_event (uint32_t event, uint64_t arg0,
+                                    uint64_t arg1);
+
+  /**
+   * Write the rings from the cache to memory, so they survive a reset.
+   */
+  void
+  aarch64_architecture_trace_flush (void);
+
+  /**
+   * True if the rings survived a reset and were not restarted.
+   */
+  bool
+  aarch64_architecture_trace_is_recovered (void);
+
+  /**
+   * The sequence number of the run that wrote the rings.
+   */
+  uint64_t
+  aarch64_architecture_trace_get_sequence (void);
+
+  /**
+   * The number of records available for `core`.
+   */
+  size_t
+  aarch64_architecture_trace_get_count (uint32_t core);
+
+  /**
+   * The record `index` of `core`, 0 being the oldest, or NULL.
+   */
+  const aarch64_architecture_trace_record_t*
+  aarch64_architecture_trace_get_record (uint32_t core, size_t index);
+
+  /**
+   * Write the rings to a host file, in the binary format. The tracing
+   * is stopped while writing. Return 0, or -1 on error.
+   */
+  int
+  aarch64_architecture_trace_write (const char* path);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace aarch64::architecture::trace
+{
+  // --------------------------------------------------------------------------
+  // Event tracer in C++.
+
+  using record = aarch64_architecture_trace_record_t;
+
+  /**
+   * Check the rings left by the previous run; true if they survived.
+   */
+  bool
+  initialize (void);
+
+  void
+  start (void);
+
+  void
+  stop (void);
+
+  /**
+   * Write a record in the ring of the current core.
+   */
+  void
+  event (uint32_t id, uint64_t arg0 = 0, uint64_t arg1 = 0);
+
+  /**
+   * Write the rings to memory.
+   */
+  void
+  flush (void);
+
+  bool
+  is_recovered (void);
+
+  uint64_t
+  sequence (void);
+
+  size_t
+  count (uint32_t core);
+
+  /**
+   * The record `index` of `core`, the oldest first, or nullptr.
+   */
+  const record*
+  get (uint32_t core, size_t index);
+
+  /**
+   * Write the rings to the host, in the binary format.
+   */
+  bool
+  write (const char* path = "trace.bin");
+
+  // --------------------------------------------------------------------------
+} // namespace aarch64::architecture::trace
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_TRACE_H_
+
+// ----------------------------------------------------------------------------
@@ -23,11 +23,74 @@
 #include <micro-os-plus/architecture-aarch64/instructions.h>
 #include <micro-os-plus/architecture-aarch64/instructions-inlines.h>
 
+#include <micro-os-plus/architecture-aarch64/atomics.h>
+#include <micro-os-plus/architecture-aarch64/atomics-inlines.h>
+
+#include <micro-os-plus/architecture-aarch64/spinlocks.h>
+#include <micro-os-plus/architecture-aarch64/spinlocks-inlines.h>
+
+#include <micro-os-plus/architecture-aarch64/cache.h>
+#include <micro-os-plus/architecture-aarch64/cache-inlines.h>
+
+#include <micro-os-plus/architecture-aarch64/mmu.h>
+#include <micro-os-plus/architecture-aarch64/mmu-inlines.h>
+
+#include <micro-os-plus/architecture-aarch64/startup.h>
+#include <micro-os-plus/architecture-aarch64/startup-inlines.h>
+
 #include <micro-os-plus/architecture-aarch64/registers.h>
 #include <micro-os-plus/architecture-aarch64/registers-inlines.h>
 
 #include <micro-os-plus/architecture-aarch64/semihosting-inlines.h>
 
+#include <micro-os-plus/architecture-aarch64/semihosting-streams.h>
+#include <micro-os-plus/architecture-aarch64/semihosting-streams-inlines.h>
+
+#include <micro-os-plus/architecture-aarch64/exceptions.h>
+#include <micro-os-plus/architecture-aarch64/exceptions-inlines.h>
+
+#include <micro-os-plus/architecture-aarch64/pmu.h>
+#include <micro-os-plus/architecture-aarch64/pmu-inlines.h>
+
+#include <micro-os-plus/architecture-aarch64/generic-timer.h>
+#include <micro-os-plus/architecture-aarch64/generic-timer-inlines.h>
+
+#include <micro-os-plus/architecture-aarch64/profiler.h>
+#include <micro-os-plus/architecture-aarch64/profiler-inlines.h>
+
+#include <micro-os-plus/architecture-aarch64/init-profiler.h>
+#include <micro-os-plus/architecture-aarch64/init-profiler-inlines.h>
+
+#include <micro-os-plus/architecture-aarch64/smp.h>
+#include <micro-os-plus/architecture-aarch64/smp-inlines.h>
+
+#include <micro-os-plus/architecture-aarch64/gic.h>
+#include <micro-os-plus/architecture-aarch64/gic-inlines.h>
+
+#include <micro-os-plus/architecture-aarch64/stacks.h>
+#include <micro-os-plus/architecture-aarch64/stacks-inlines.h>
+
+#include <micro-os-plus/architecture-aarch64/crypto.h>
+#include <micro-os-plus/architecture-aarch64/crypto-inlines.h>
+
+#include <micro-os-plus/architecture-aarch64/memory.h>
+#include <micro-os-plus/architecture-aarch64/memory-inlines.h>
+
+#include <micro-os-plus/architecture-aarch64/queues.h>
+#include <micro-os-plus/architecture-aarch64/queues-inlines.h>
+
+#include <micro-os-plus/architecture-aarch64/syscalls.h>
+#include <micro-os-plus/architecture-aarch64/syscalls-inlines.h>
+
+#include <micro-os-plus/architecture-aarch64/trace.h>
+#include <micro-os-plus/architecture-aarch64/trace-inlines.h>
+
+#include <micro-os-plus/architecture-aarch64/clock.h>
+#include <micro-os-plus/architecture-aarch64/clock-inlines.h>
+
+#include <micro-os-plus/architecture-aarch64/dsp.h>
+#include <micro-os-plus/architecture-aarch64/dsp-inlines.h>
+
 // ----------------------------------------------------------------------------
 
 #endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_ARCHITECTURE_H_
@@ -0,0 +1,78 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_INCLUDE_CONFIG_H)
+#include <micro-os-plus/config.h>
+#endif // MICRO_OS_PLUS_INCLUDE_CONFIG_H
+
+#include <micro-os-plus/architecture.h>
+
+#if defined(MICRO_OS_PLUS_INCLUDE_CLOCK)
+
+// ----------------------------------------------------------------------------
+
+aarch64_architecture_clock_t aarch64_architecture_clock;
+
+namespace
+{
+  constexpr uint64_t ns_per_second = 1000000000u;
+
+  // The fractional part of `numerator / denominator`, scaled by 2^64.
+  uint64_t
+  fraction (uint64_t numerator, uint64_t denominator)
+  {
+    return static_cast<uint64_t> (
+        (static_cast<unsigned __int128> (numerator % denominator) << 64)
+        / denominator);
+  }
+
+  // Before the static constructors, which may already use the clock.
+  __attribute__ ((section (".preinit_array_sysinit"), used))
+  void (*const initialize_clock) (void)
+      = aarch64_architecture_clock_initialize;
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+void
+aarch64_architecture_clock_calibrate (aarch64_architecture_clock_t* clock,
+                                      uint32_t frequency)
+{
+  if (frequency == 0)
+    {
+      // CNTFRQ_EL0 not set by the firmware; the time remains 0.
+      *clock = aarch64_architecture_clock_t{};
+      return;
+    }
+
+  clock->ns_per_tick = ns_per_second / frequency;
+  clock->ns_per_tick_fraction = fraction (ns_per_second, frequency);
+  clock->ticks_per_ns = frequency / ns_per_second;
+  clock->ticks_per_ns_fraction = fraction (frequency, ns_per_second);
+  clock->frequency = frequency;
+}
+
+void
+aarch64_architecture_clock_initialize (void)
+{
+  aarch64_architecture_clock_calibrate (
+      &aarch64_architecture_clock,
+      aarch64_architecture_generic_timer_get_frequency ());
+}
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(MICRO_OS_PLUS_INCLUDE_CLOCK)
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,689 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_INCLUDE_CONFIG_H)
+#include <micro-os-plus/config.h>
+#endif // MICRO_OS_PLUS_INCLUDE_CONFIG_H
+
+#include <micro-os-plus/architecture.h>
+
+#if defined(MICRO_OS_PLUS_INCLUDE_CRYPTO)
+
+#include <cstring>
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+  // Set once the ID register was read.
+  constexpr uint32_t features_valid = 1u << 31;
+
+  // Several cores may read the ID register at the same time, with
+  // the same result.
+  volatile uint32_t cached_features;
+
+  volatile uint32_t selected_features
+      = AARCH64_CRYPTO_FEATURE_CRC32 | AARCH64_CRYPTO_FEATURE_AES
+        | AARCH64_CRYPTO_FEATURE_PMULL | AARCH64_CRYPTO_FEATURE_SHA256;
+
+  // --------------------------------------------------------------------------
+  // Portable CRC, one table lookup per byte.
+
+  struct crc_table
+  {
+    uint32_t values[256];
+  };
+
+  constexpr crc_table
+  make_crc_table (uint32_t reflected_polynomial)
+  {
+    crc_table table{};
+    for (uint32_t i = 0; i < 256; ++i)
+      {
+        uint32_t value = i;
+        for (int bit = 0; bit < 8; ++bit)
+          {
+            value = (value >> 1) ^ ((value & 1) ? reflected_polynomial : 0);
+          }
+        table.values[i] = value;
+      }
+    return table;
+  }
+
+  constexpr crc_table crc32_table = make_crc_table (0xEDB88320);
+  constexpr crc_table crc32c_table = make_crc_table (0x82F63B78);
+
+  uint32_t
+  crc_portable (const crc_table& table, uint32_t crc, const uint8_t* data,
+                size_t size)
+  {
+    for (size_t i = 0; i < size; ++i)
+      {
+        crc = (crc >> 8) ^ table.values[(crc ^ data[i]) & 0xFF];
+      }
+    return crc;
+  }
+
+  // --------------------------------------------------------------------------
+  // Portable AES, byte oriented, as in FIPS-197.
+
+  constexpr uint8_t sbox[256] = {
+    0x63, 0x7C, 0x77, 0x7B, 0xF2, 0x6B, 0x6F, 0xC5, //
+    0x30, 0x01, 0x67, 0x2B, 0xFE, 0xD7, 0xAB, 0x76, //
+    0xCA, 0x82, 0xC9, 0x7D, 0xFA, 0x59, 0x47, 0xF0, //
+    0xAD, 0xD4, 0xA2, 0xAF, 0x9C, 0xA4, 0x72, 0xC0, //
+    0xB7, 0xFD, 0x93, 0x26, 0x36, 0x3F, 0xF7, 0xCC, //
+    0x34, 0xA5, 0xE5, 0xF1, 0x71, 0xD8, 0x31, 0x15, //
+    0x04, 0xC7, 0x23, 0xC3, 0x18, 0x96, 0x05, 0x9A, //
+    0x07, 0x12, 0x80, 0xE2, 0xEB, 0x27, 0xB2, 0x75, //
+    0x09, 0x83, 0x2C, 0x1A, 0x1B, 0x6E, 0x5A, 0xA0, //
+    0x52, 0x3B, 0xD6, 0xB3, 0x29, 0xE3, 0x2F, 0x84, //
+    0x53, 0xD1, 0x00, 0xED, 0x20, 0xFC, 0xB1, 0x5B, //
+    0x6A, 0xCB, 0xBE, 0x39, 0x4A, 0x4C, 0x58, 0xCF, //
+    0xD0, 0xEF, 0xAA, 0xFB, 0x43, 0x4D, 0x33, 0x85, //
+    0x45, 0xF9, 0x02, 0x7F, 0x50, 0x3C, 0x9F, 0xA8, //
+    0x51, 0xA3, 0x40, 0x8F, 0x92, 0x9D, 0x38, 0xF5, //
+    0xBC, 0xB6, 0xDA, 0x21, 0x10, 0xFF, 0xF3, 0xD2, //
+    0xCD, 0x0C, 0x13, 0xEC, 0x5F, 0x97, 0x44, 0x17, //
+    0xC4, 0xA7, 0x7E, 0x3D, 0x64, 0x5D, 0x19, 0x73, //
+    0x60, 0x81, 0x4F, 0xDC, 0x22, 0x2A, 0x90, 0x88, //
+    0x46, 0xEE, 0xB8, 0x14, 0xDE, 0x5E, 0x0B, 0xDB, //
+    0xE0, 0x32, 0x3A, 0x0A, 0x49, 0x06, 0x24, 0x5C, //
+    0xC2, 0xD3, 0xAC, 0x62, 0x91, 0x95, 0xE4, 0x79, //
+    0xE7, 0xC8, 0x37, 0x6D, 0x8D, 0xD5, 0x4E, 0xA9, //
+    0x6C, 0x56, 0xF4, 0xEA, 0x65, 0x7A, 0xAE, 0x08, //
+    0xBA, 0x78, 0x25, 0x2E, 0x1C, 0xA6, 0xB4, 0xC6, //
+    0xE8, 0xDD, 0x74, 0x1F, 0x4B, 0xBD, 0x8B, 0x8A, //
+    0x70, 0x3E, 0xB5, 0x66, 0x48, 0x03, 0xF6, 0x0E, //
+    0x61, 0x35, 0x57, 0xB9, 0x86, 0xC1, 0x1D, 0x9E, //
+    0xE1, 0xF8, 0x98, 0x11, 0x69, 0xD9, 0x8E, 0x94, //
+    0x9B, 0x1E, 0x87, 0xE9, 0xCE, 0x55, 0x28, 0xDF, //
+    0x8C, 0xA1, 0x89, 0x0D, 0xBF, 0xE6, 0x42, 0x68, //
+    0x41, 0x99, 0x2D, 0x0F, 0xB0, 0x54, 0xBB, 0x16, //
+  };
+
+  constexpr uint8_t
+  xtime (uint8_t value)
+  {
+    return static_cast<uint8_t> ((value << 1) ^ ((value & 0x80) ? 0x1B : 0));
+  }
+
+  void
+  aes_encrypt_portable (const aarch64_architecture_aes_key_t* key,
+                        const uint8_t* in, uint8_t* out)
+  {
+    uint8_t state[16];
+    for (int i = 0; i < 16; ++i)
+      {
+        state[i] = in[i] ^ key->round_keys[0][i];
+      }
+
+    for (uint32_t round = 1; round <= key->rounds; ++round)
+      {
+        // SubBytes and ShiftRows; the state is stored by columns.
+        uint8_t shifted[16];
+        for (int column = 0; column < 4; ++column)
+          {
+            for (int row = 0; row < 4; ++row)
+              {
+                shifted[4 * column + row]
+                    = sbox[state[4 * ((column + row) % 4) + row]];
+              }
+          }
+
+        if (round != key->rounds)
+          {
+            for (int column = 0; column < 4; ++column)
+              {
+                uint8_t* c = &shifted[4 * column];
+                uint8_t all = c[0] ^ c[1] ^ c[2] ^ c[3];
+                uint8_t first = c[0];
+                for (int row = 0; row < 4; ++row)
+                  {
+                    uint8_t next = (row == 3) ? first : c[row + 1];
+                    c[row] = static_cast<uint8_t> (c[row] ^ all
+                                                   ^ xtime (c[row] ^ next));
+                  }
+              }
+          }
+
+        for (int i = 0; i < 16; ++i)
+          {
+            state[i] = shifted[i] ^ key->round_keys[round][i];
+          }
+      }
+
+    memcpy (out, state, sizeof (state));
+  }
+
+  // --------------------------------------------------------------------------
+  // Portable GHASH, one bit at a time (NIST SP 800-38D, Algorithm 1).
+
+  void
+  gf128_multiply (uint8_t x[16], const uint8_t y[16])
+  {
+    uint64_t z_high = 0;
+    uint64_t z_low = 0;
+    uint64_t v_high = 0;
+    uint64_t v_low = 0;
+    for (int i = 0; i < 8; ++i)
+      {
+        v_high = (v_high << 8) | y[i];
+        v_low = (v_low << 8) | y[i + 8];
+      }
+
+    for (int i = 0; i < 128; ++i)
+      {
+        if ((x[i / 8] >> (7 - i % 8)) & 1)
+          {
+            z_high ^= v_high;
+            z_low ^= v_low;
+          }
+        uint64_t carry = v_low & 1;
+        v_low = (v_low >> 1) | (v_high << 63);
+        v_high = (v_high >> 1) ^ (carry ? 0xE100000000000000ULL : 0);
+      }
+
+    for (int i = 0; i < 8; ++i)
+      {
+        x[i] = static_cast<uint8_t> (z_high >> (56 - 8 * i));
+        x[i + 8] = static_cast<uint8_t> (z_low >> (56 - 8 * i));
+      }
+  }
+
+  void
+  ghash_blocks (uint8_t state[16], const uint8_t h[16], const uint8_t* data,
+                size_t blocks)
+  {
+    if (aarch64_architecture_crypto_get_features ()
+        & AARCH64_CRYPTO_FEATURE_PMULL)
+      {
+        aarch64_architecture_ghash_ce (state, h, data, blocks);
+        return;
+      }
+
+    for (size_t block = 0; block < blocks; ++block, data += 16)
+      {
+        for (int i = 0; i < 16; ++i)
+          {
+            state[i] ^= data[i];
+          }
+        gf128_multiply (state, h);
+      }
+  }
+
+  // The partial last block is padded with zeros.
+  void
+  ghash (uint8_t state[16], const uint8_t h[16], const uint8_t* data,
+         size_t size)
+  {
+    ghash_blocks (state, h, data, size / 16);
+
+    size_t tail = size % 16;
+    if (tail != 0)
+      {
+        uint8_t block[16] = {};
+        memcpy (block, data + size - tail, tail);
+        ghash_blocks (state, h, block, 1);
+      }
+  }
+
+  // --------------------------------------------------------------------------
+  // AES-GCM (NIST SP 800-38D), with 12 bytes IVs.
+
+  void
+  gcm_increment (uint8_t counter[16])
+  {
+    for (int i = 15; i >= 12; --i)
+      {
+        if (++counter[i] != 0)
+          {
+            break;
+          }
+      }
+  }
+
+  void
+  gcm_ctr (const aarch64_architecture_aes_key_t* key, uint8_t counter[16],
+           const uint8_t* in, uint8_t* out, size_t size)
+  {
+    size_t blocks = size / 16;
+    if (aarch64_architecture_crypto_get_features ()
+        & AARCH64_CRYPTO_FEATURE_AES)
+      {
+        aarch64_architecture_aes_ctr_ce (key, counter, in, out, blocks);
+        in += blocks * 16;
+        out += blocks * 16;
+        size -= blocks * 16;
+      }
+
+    while (size != 0)
+      {
+        uint8_t stream[16];
+        aarch64_architecture_aes_encrypt_block (key, counter, stream);
+        gcm_increment (counter);
+
+        size_t count = (size < 16) ? size : 16;
+        for (size_t i = 0; i < count; ++i)
+          {
+            out[i] = in[i] ^ stream[i];
+          }
+        in += count;
+        out += count;
+        size -= count;
+      }
+  }
+
+  // The tag of the cipher text.
+  void
+  gcm_tag (const aarch64_architecture_aes_gcm_t* gcm, const uint8_t j0[16],
+           const uint8_t* aad, size_t aad_size, const uint8_t* cipher,
+           size_t size, uint8_t tag[16])
+  {
+    uint8_t state[16] = {};
+    ghash (state, gcm->h, aad, aad_size);
+    ghash (state, gcm->h, cipher, size);
+
+    // The sizes, in bits, big endian.
+    uint8_t lengths[16];
+    for (int i = 0; i < 8; ++i)
+      {
+        lengths[i] = static_cast<uint8_t> (
+            (static_cast<uint64_t> (aad_size) * 8) >> (56 - 8 * i));
+        lengths[i + 8] = static_cast<uint8_t> (
+            (static_cast<uint64_t> (size) * 8) >> (56 - 8 * i));
+      }
+    ghash_blocks (state, gcm->h, lengths, 1);
+
+    aarch64_architecture_aes_encrypt_block (&gcm->key, j0, tag);
+    for (int i = 0; i < 16; ++i)
+      {
+        tag[i] ^= state[i];
+      }
+  }
+
+  // --------------------------------------------------------------------------
+  // Portable SHA-256 (FIPS 180-4).
+
+  constexpr uint32_t sha256_k[64] = {
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, //
+    0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5, //
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, //
+    0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174, //
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, //
+    0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA, //
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, //
+    0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967, //
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, //
+    0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85, //
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, //
+    0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070, //
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, //
+    0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3, //
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, //
+    0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2, //
+  };
+
+  constexpr uint32_t
+  rotate_right (uint32_t value, int count)
+  {
+    return (value >> count) | (value << (32 - count));
+  }
+
+  void
+  sha256_portable (uint32_t state[8], const uint8_t* data, size_t blocks)
+  {
+    for (size_t block = 0; block < blocks; ++block, data += 64)
+      {
+        uint32_t w[64];
+        for (int i = 0; i < 16; ++i)
+          {
+            w[i] = (static_cast<uint32_t> (data[4 * i]) << 24)
+                   | (static_cast<uint32_t> (data[4 * i + 1]) << 16)
+                   | (static_cast<uint32_t> (data[4 * i + 2]) << 8)
+                   | data[4 * i + 3];
+          }
+        for (int i = 16; i < 64; ++i)
+          {
+            uint32_t s0 = rotate_right (w[i - 15], 7)
+                          ^ rotate_right (w[i - 15], 18) ^ (w[i - 15] >> 3);
+            uint32_t s1 = rotate_right (w[i - 2], 17)
+                          ^ rotate_right (w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+          }
+
+        uint32_t v[8];
+        memcpy (v, state, sizeof (v));
+        for (int i = 0; i < 64; ++i)
+          {
+            uint32_t s1 = rotate_right (v[4], 6) ^ rotate_right (v[4], 11)
+                          ^ rotate_right (v[4], 25);
+            uint32_t choose = (v[4] & v[5]) ^ (~v[4] & v[6]);
+            uint32_t t1 = v[7] + s1 + choose + sha256_k[i] + w[i];
+            uint32_t s0 = rotate_right (v[0], 2) ^ rotate_right (v[0], 13)
+                          ^ rotate_right (v[0], 22);
+            uint32_t majority
+                = (v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]);
+            uint32_t t2 = s0 + majority;
+
+            v[7] = v[6];
+            v[6] = v[5];
+            v[5] = v[4];
+            v[4] = v[3] + t1;
+            v[3] = v[2];
+            v[2] = v[1];
+            v[1] = v[0];
+            v[0] = t1 + t2;
+          }
+
+        for (int i = 0; i < 8; ++i)
+          {
+            state[i] += v[i];
+          }
+      }
+  }
+
+  // --------------------------------------------------------------------------
+
+  uint32_t
+  implemented_features (void)
+  {
+    uint32_t features = cached_features;
+    if (features & features_valid)
+      {
+        return features & ~features_valid;
+      }
+
+    using namespace aarch64::architecture::registers;
+    using isar0 = sysreg<"ID_AA64ISAR0_EL1">;
+
+    features = features_valid;
+
+    // The features enabled by -mcpu/-march need no check.
+#if defined(__ARM_FEATURE_CRC32)
+    features |= AARCH64_CRYPTO_FEATURE_CRC32;
+#else
+    if (isar0::read (id_aa64isar0_el1::crc32) >= 1)
+      {
+        features |= AARCH64_CRYPTO_FEATURE_CRC32;
+      }
+#endif // defined(__ARM_FEATURE_CRC32)
+
+    // 1 is AES, 2 is AES and PMULL.
+    uint32_t aes = isar0::read (id_aa64isar0_el1::aes);
+    if (aes >= 1)
+      {
+        features |= AARCH64_CRYPTO_FEATURE_AES;
+      }
+    if (aes >= 2)
+      {
+        features |= AARCH64_CRYPTO_FEATURE_PMULL;
+      }
+
+    if (isar0::read (id_aa64isar0_el1::sha2) >= 1)
+      {
+        features |= AARCH64_CRYPTO_FEATURE_SHA256;
+      }
+
+    cached_features = features;
+
+    return features & ~features_valid;
+  }
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+uint32_t
+aarch64_architecture_crypto_get_features (void)
+{
+  return implemented_features () & selected_features;
+}
+
+uint32_t
+aarch64_architecture_crypto_select_features (uint32_t features)
+{
+  uint32_t previous = selected_features;
+  selected_features = features;
+  return previous;
+}
+
+uint32_t
+aarch64_architecture_crc32 (uint32_t crc, const void* data, size_t size)
+{
+  uint32_t features = aarch64_architecture_crypto_get_features ();
+  if (features & AARCH64_CRYPTO_FEATURE_CRC32)
+    {
+      return ~aarch64_architecture_crc32_ce (~crc, data, size, features);
+    }
+
+  return ~crc_portable (crc32_table, ~crc,
+                        static_cast<const uint8_t*> (data), size);
+}
+
+uint32_t
+aarch64_architecture_crc32c (uint32_t crc, const void* data, size_t size)
+{
+  uint32_t features = aarch64_architecture_crypto_get_features ();
+  if (features & AARCH64_CRYPTO_FEATURE_CRC32)
+    {
+      return ~aarch64_architecture_crc32c_ce (~crc, data, size, features);
+    }
+
+  return ~crc_portable (crc32c_table, ~crc,
+                        static_cast<const uint8_t*> (data), size);
+}
+
+int
+aarch64_architecture_aes_set_key (aarch64_architecture_aes_key_t* key,
+                                  const void* bytes, size_t size)
+{
+  if (size != 16 && size != 24 && size != 32)
+    {
+      return -1;
+    }
+
+  // The key schedule, as 4 bytes words (FIPS-197, 5.2).
+  uint8_t* words = &key->round_keys[0][0];
+  size_t key_words = size / 4;
+  key->rounds = static_cast<uint32_t> (key_words + 6);
+  size_t total_words = 4 * (key->rounds + 1);
+
+  memcpy (words, bytes, size);
+
+  uint8_t round_constant = 1;
+  for (size_t i = key_words; i < total_words; ++i)
+    {
+      uint8_t temp[4];
+      memcpy (temp, &words[4 * (i - 1)], 4);
+
+      if (i % key_words == 0)
+        {
+          uint8_t first = temp[0];
+          temp[0] = sbox[temp[1]] ^ round_constant;
+          temp[1] = sbox[temp[2]];
+          temp[2] = sbox[temp[3]];
+          temp[3] = sbox[first];
+          round_constant = xtime (round_constant);
+        }
+      else if (key_words > 6 && i % key_words == 4)
+        {
+          for (int j = 0; j < 4; ++j)
+            {
+              temp[j] = sbox[temp[j]];
+            }
+        }
+
+      for (int j = 0; j < 4; ++j)
+        {
+          words[4 * i + j] = words[4 * (i - key_words) + j] ^ temp[j];
+        }
+    }
+
+  return 0;
+}
+
+void
+aarch64_architecture_aes_encrypt_block (
+    const aarch64_architecture_aes_key_t* key, const void* in, void* out)
+{
+  if (aarch64_architecture_crypto_get_features ()
+      & AARCH64_CRYPTO_FEATURE_AES)
+    {
+      aarch64_architecture_aes_encrypt_block_ce (key, in, out);
+      return;
+    }
+
+  aes_encrypt_portable (key, static_cast<const uint8_t*> (in),
+                        static_cast<uint8_t*> (out));
+}
+
+int
+aarch64_architecture_aes_gcm_set_key (aarch64_architecture_aes_gcm_t* gcm,
+                                      const void* bytes, size_t size)
+{
+  if (aarch64_architecture_aes_set_key (&gcm->key, bytes, size) != 0)
+    {
+      return -1;
+    }
+
+  // H is the encrypted zero block.
+  memset (gcm->h, 0, sizeof (gcm->h));
+  aarch64_architecture_aes_encrypt_block (&gcm->key, gcm->h, gcm->h);
+
+  return 0;
+}
+
+void
+aarch64_architecture_aes_gcm_encrypt (
+    const aarch64_architecture_aes_gcm_t* gcm, const void* iv,
+    const void* aad, size_t aad_size, const void* in, void* out, size_t size,
+    void* tag)
+{
+  uint8_t j0[16] = {};
+  memcpy (j0, iv, AARCH64_AES_GCM_IV_SIZE);
+  j0[15] = 1;
+
+  uint8_t counter[16];
+  memcpy (counter, j0, sizeof (counter));
+  gcm_increment (counter);
+
+  gcm_ctr (&gcm->key, counter, static_cast<const uint8_t*> (in),
+           static_cast<uint8_t*> (out), size);
+
+  gcm_tag (gcm, j0, static_cast<const uint8_t*> (aad), aad_size,
+           static_cast<const uint8_t*> (out), size,
+           static_cast<uint8_t*> (tag));
+}
+
+int
+aarch64_architecture_aes_gcm_decrypt (
+    const aarch64_architecture_aes_gcm_t* gcm, const void* iv,
+    const void* aad, size_t aad_size, const void* in, void* out, size_t size,
+    const void* tag)
+{
+  uint8_t j0[16] = {};
+  memcpy (j0, iv, AARCH64_AES_GCM_IV_SIZE);
+  j0[15] = 1;
+
+  // Check the tag first, so nothing is decrypted if it does not match;
+  // the comparison time does not depend on the data.
+  uint8_t expected[16];
+  gcm_tag (gcm, j0, static_cast<const uint8_t*> (aad), aad_size,
+           static_cast<const uint8_t*> (in), size, expected);
+
+  const uint8_t* received = static_cast<const uint8_t*> (tag);
+  uint8_t difference = 0;
+  for (int i = 0; i < 16; ++i)
+    {
+      difference |= expected[i] ^ received[i];
+    }
+  if (difference != 0)
+    {
+      return -1;
+    }
+
+  uint8_t counter[16];
+  memcpy (counter, j0, sizeof (counter));
+  gcm_increment (counter);
+
+  gcm_ctr (&gcm->key, counter, static_cast<const uint8_t*> (in),
+           static_cast<uint8_t*> (out), size);
+
+  return 0;
+}
+
+void
+aarch64_architecture_sha256_blocks (uint32_t state[8], const void* data,
+                                    size_t blocks)
+{
+  if (aarch64_architecture_crypto_get_features ()
+      & AARCH64_CRYPTO_FEATURE_SHA256)
+    {
+      aarch64_architecture_sha256_blocks_ce (state, data, blocks);
+      return;
+    }
+
+  sha256_portable (state, static_cast<const uint8_t*> (data), blocks);
+}
+
+void
+aarch64_architecture_sha256 (const void* data, size_t size,
+                             uint8_t digest[AARCH64_SHA256_DIGEST_SIZE])
+{
+  uint32_t state[8] = {
+    0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A,
+    0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19,
+  };
+
+  size_t blocks = size / AARCH64_SHA256_BLOCK_SIZE;
+  aarch64_architecture_sha256_blocks (state, data, blocks);
+
+  // The last bytes, 0x80, zeros and the size in bits, big endian;
+  // one or two blocks.
+  const uint8_t* tail = static_cast<const uint8_t*> (data)
+                       + blocks * AARCH64_SHA256_BLOCK_SIZE;
+  size_t tail_size = size % AARCH64_SHA256_BLOCK_SIZE;
+
+  uint8_t last[2 * AARCH64_SHA256_BLOCK_SIZE] = {};
+  if (tail_size != 0)
+    {
+      memcpy (last, tail, tail_size);
+    }
+  last[tail_size] = 0x80;
+
+  size_t last_size = (tail_size < AARCH64_SHA256_BLOCK_SIZE - 8)
+                         ? AARCH64_SHA256_BLOCK_SIZE
+                         : 2 * AARCH64_SHA256_BLOCK_SIZE;
+  uint64_t bits = static_cast<uint64_t> (size) * 8;
+  for (int i = 0; i < 8; ++i)
+    {
+      last[last_size - 1 - i] = static_cast<uint8_t> (bits >> (8 * i));
+    }
+  aarch64_architecture_sha256_blocks (state, last,
+                                      last_size / AARCH64_SHA256_BLOCK_SIZE);
+
+  for (int i = 0; i < 8; ++i)
+    {
+      digest[4 * i] = static_cast<uint8_t> (state[i] >> 24);
+      digest[4 * i + 1] = static_cast<uint8_t> (state[i] >> 16);
+      digest[4 * i + 2] = static_cast<uint8_t> (state[i] >> 8);
+      digest[4 * i + 3] = static_cast<uint8_t> (state[i]);
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(MICRO_OS_PLUS_INCLUDE_CRYPTO)
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,337 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_INCLUDE_CONFIG_H)
+#include <micro-os-plus/config.h>
+#endif // MICRO_OS_PLUS_INCLUDE_CONFIG_H
+
+#include <micro-os-plus/architecture.h>
+
+#if defined(MICRO_OS_PLUS_INCLUDE_DSP)
+
+#include <cmath>
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+  // Set once the ID register was read.
+  constexpr uint32_t features_valid = 1u << 31;
+
+  // Several cores may read the ID register at the same time, with
+  // the same result.
+  volatile uint32_t cached_features;
+
+  volatile uint32_t selected_features
+      = AARCH64_DSP_FEATURE_ASIMD | AARCH64_DSP_FEATURE_SVE;
+
+  // Before the static constructors, which may already use the kernels;
+  // the secondary cores call it from their reset code.
+  __attribute__ ((section (".preinit_array_sysinit"), used))
+  void (*const initialize_dsp) (void) = aarch64_architecture_dsp_initialize;
+
+  uint32_t
+  implemented_features (void)
+  {
+    uint32_t features = cached_features;
+    if (features & features_valid)
+      {
+        return features & ~features_valid;
+      }
+
+    using namespace aarch64::architecture::registers;
+    using pfr0 = sysreg<"ID_AA64PFR0_EL1">;
+
+    features = features_valid;
+
+    // 0b1111 is not implemented.
+    if (pfr0::read (id_aa64pfr0_el1::advsimd) != 0xF)
+      {
+        features |= AARCH64_DSP_FEATURE_ASIMD;
+      }
+
+    if (pfr0::read (id_aa64pfr0_el1::sve) >= 1)
+      {
+        features |= AARCH64_DSP_FEATURE_SVE;
+      }
+
+    cached_features = features;
+
+    return features & ~features_valid;
+  }
+
+  // The interrupts do not preserve the Z registers above 128 bits,
+  // so, if they save the SIMD/FP context, the SVE kernels run with
+  // the IRQs masked.
+  class sve_guard
+  {
+  public:
+    sve_guard ()
+    {
+#if defined(MICRO_OS_PLUS_USE_INTERRUPTS_FP_CONTEXT)
+      daif_ = aarch64_architecture_interrupts_save_and_disable ();
+#endif // defined(MICRO_OS_PLUS_USE_INTERRUPTS_FP_CONTEXT)
+    }
+
+    ~sve_guard ()
+    {
+#if defined(MICRO_OS_PLUS_USE_INTERRUPTS_FP_CONTEXT)
+      aarch64_architecture_interrupts_restore (daif_);
+#endif // defined(MICRO_OS_PLUS_USE_INTERRUPTS_FP_CONTEXT)
+    }
+
+    sve_guard (const sve_guard&) = delete;
+
+    sve_guard&
+    operator= (const sve_guard&)
+        = delete;
+
+#if defined(MICRO_OS_PLUS_USE_INTERRUPTS_FP_CONTEXT)
+  protected:
+    aarch64_architecture_register_t daif_;
+#endif // defined(MICRO_OS_PLUS_USE_INTERRUPTS_FP_CONTEXT)
+  };
+
+  // --------------------------------------------------------------------------
+  // Portable kernels, the reference for the vector ones.
+
+  float
+  dot_portable (const float* a, const float* b, size_t count)
+  {
+    float sum = 0;
+    for (size_t i = 0; i < count; ++i)
+      {
+        sum += a[i] * b[i];
+      }
+    return sum;
+  }
+
+  void
+  fir_portable (const float* coefficients, size_t taps, const float* in,
+                float* out, size_t count)
+  {
+    for (size_t i = 0; i < count; ++i)
+      {
+        out[i] = dot_portable (coefficients, in + i, taps);
+      }
+  }
+
+  void
+  gemv_s8_portable (const int8_t* matrix, const int8_t* x, int32_t* y,
+                    size_t rows, size_t columns)
+  {
+    for (size_t r = 0; r < rows; ++r, matrix += columns)
+      {
+        int32_t sum = 0;
+        for (size_t c = 0; c < columns; ++c)
+          {
+            sum += int32_t{ matrix[c] } * int32_t{ x[c] };
+          }
+        y[r] = sum;
+      }
+  }
+
+  void
+  gemv_f16_portable (const aarch64_architecture_float16_t* matrix,
+                     const aarch64_architecture_float16_t* x, float* y,
+                     size_t rows, size_t columns)
+  {
+    for (size_t r = 0; r < rows; ++r, matrix += columns)
+      {
+        float sum = 0;
+        for (size_t c = 0; c < columns; ++c)
+          {
+            sum += static_cast<float> (matrix[c]) * static_cast<float> (x[c]);
+          }
+        y[r] = sum;
+      }
+  }
+
+  void
+  min_max_portable (const float* data, size_t count, float* min, float* max)
+  {
+    float low = data[0];
+    float high = data[0];
+    for (size_t i = 1; i < count; ++i)
+      {
+        low = std::fmin (low, data[i]);
+        high = std::fmax (high, data[i]);
+      }
+    *min = low;
+    *max = high;
+  }
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+uint32_t
+aarch64_architecture_dsp_get_features (void)
+{
+  return implemented_features () & selected_features;
+}
+
+uint32_t
+aarch64_architecture_dsp_select_features (uint32_t features)
+{
+  uint32_t previous = selected_features;
+  selected_features = features;
+  return previous;
+}
+
+size_t
+aarch64_architecture_dsp_get_vector_length (void)
+{
+  if (aarch64_architecture_dsp_get_features () & AARCH64_DSP_FEATURE_SVE)
+    {
+      return aarch64_architecture_dsp_get_vector_length_sve ();
+    }
+  return 16;
+}
+
+size_t
+aarch64_architecture_dsp_set_vector_length (size_t bytes)
+{
+  if (!(implemented_features () & AARCH64_DSP_FEATURE_SVE))
+    {
+      return 16;
+    }
+
+  // ZCR_EL1.LEN is the number of 128-bit segments minus 1.
+  size_t segments = bytes / 16;
+  if (segments < 1)
+    {
+      segments = 1;
+    }
+  else if (segments > 16)
+    {
+      segments = 16;
+    }
+
+  return aarch64_architecture_dsp_set_vector_length_sve (
+      static_cast<uint32_t> (segments - 1));
+}
+
+float
+aarch64_architecture_dsp_dot_f32 (const float* a, const float* b,
+                                  size_t count)
+{
+  uint32_t features = aarch64_architecture_dsp_get_features ();
+  if (features & AARCH64_DSP_FEATURE_SVE)
+    {
+      sve_guard guard;
+      return aarch64_architecture_dsp_dot_f32_sve (a, b, count);
+    }
+  if (features & AARCH64_DSP_FEATURE_ASIMD)
+    {
+      return aarch64_architecture_dsp_dot_f32_asimd (a, b, count);
+    }
+
+  return dot_portable (a, b, count);
+}
+
+void
+aarch64_architecture_dsp_fir_f32 (const float* coefficients, size_t taps,
+                                  const float* in, float* out, size_t count)
+{
+  uint32_t features = aarch64_architecture_dsp_get_features ();
+  if (features & AARCH64_DSP_FEATURE_SVE)
+    {
+      sve_guard guard;
+      aarch64_architecture_dsp_fir_f32_sve (coefficients, taps, in, out,
+                                            count);
+      return;
+    }
+  if (features & AARCH64_DSP_FEATURE_ASIMD)
+    {
+      aarch64_architecture_dsp_fir_f32_asimd (coefficients, taps, in, out,
+                                              count);
+      return;
+    }
+
+  fir_portable (coefficients, taps, in, out, count);
+}
+
+void
+aarch64_architecture_dsp_gemv_s8 (const int8_t* matrix, const int8_t* x,
+                                  int32_t* y, size_t rows, size_t columns)
+{
+  uint32_t features = aarch64_architecture_dsp_get_features ();
+  if (features & AARCH64_DSP_FEATURE_SVE)
+    {
+      sve_guard guard;
+      aarch64_architecture_dsp_gemv_s8_sve (matrix, x, y, rows, columns);
+      return;
+    }
+  if (features & AARCH64_DSP_FEATURE_ASIMD)
+    {
+      aarch64_architecture_dsp_gemv_s8_asimd (matrix, x, y, rows, columns);
+      return;
+    }
+
+  gemv_s8_portable (matrix, x, y, rows, columns);
+}
+
+void
+aarch64_architecture_dsp_gemv_f16 (
+    const aarch64_architecture_float16_t* matrix,
+    const aarch64_architecture_float16_t* x, float* y, size_t rows,
+    size_t columns)
+{
+  uint32_t features = aarch64_architecture_dsp_get_features ();
+  if (features & AARCH64_DSP_FEATURE_SVE)
+    {
+      sve_guard guard;
+      aarch64_architecture_dsp_gemv_f16_sve (matrix, x, y, rows, columns);
+      return;
+    }
+  if (features & AARCH64_DSP_FEATURE_ASIMD)
+    {
+      aarch64_architecture_dsp_gemv_f16_asimd (matrix, x, y, rows, columns);
+      return;
+    }
+
+  gemv_f16_portable (matrix, x, y, rows, columns);
+}
+
+int
+aarch64_architecture_dsp_min_max_f32 (const float* data, size_t count,
+                                      float* min, float* max)
+{
+  if (count == 0)
+    {
+      return -1;
+    }
+
+  uint32_t features = aarch64_architecture_dsp_get_features ();
+  if (features & AARCH64_DSP_FEATURE_SVE)
+    {
+      sve_guard guard;
+      aarch64_architecture_dsp_min_max_f32_sve (data, count, min, max);
+      return 0;
+    }
+  if (features & AARCH64_DSP_FEATURE_ASIMD)
+    {
+      aarch64_architecture_dsp_min_max_f32_asimd (data, count, min, max);
+      return 0;
+    }
+
+  min_max_portable (data, count, min, max);
+  return 0;
+}
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(MICRO_OS_PLUS_INCLUDE_DSP)
+
+// ----------------------------------------------------------------------------
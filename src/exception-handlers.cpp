@@ -0,0 +1,75 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_INCLUDE_CONFIG_H)
+#include <micro-os-plus/config.h>
+#endif // MICRO_OS_PLUS_INCLUDE_CONFIG_H
+
+#include <micro-os-plus/architecture.h>
+
+#include <cstddef>
+
+#if defined(MICRO_OS_PLUS_INCLUDE_EXCEPTION_VECTORS)
+
+// ----------------------------------------------------------------------------
+
+static_assert (sizeof (aarch64_architecture_exception_frame_t)
+                   == AARCH64_EXCEPTION_FRAME_SIZE,
+               "Adjust AARCH64_EXCEPTION_FRAME_SIZE");
+static_assert (offsetof (aarch64_architecture_exception_frame_t, elr)
+                   == AARCH64_EXCEPTION_FRAME_ELR,
+               "Adjust AARCH64_EXCEPTION_FRAME_ELR");
+static_assert (offsetof (aarch64_architecture_exception_full_frame_t, frame)
+                   == AARCH64_EXCEPTION_FULL_FRAME_EXTRA_SIZE,
+               "Adjust AARCH64_EXCEPTION_FULL_FRAME_EXTRA_SIZE");
+
+volatile uint32_t aarch64_architecture_interrupts_context_switch_pending
+    [MICRO_OS_PLUS_INTEGER_SMP_MAX_CORES];
+
+// ----------------------------------------------------------------------------
+// Default handlers, to be redefined by the application.
+
+__attribute__ ((weak)) void
+aarch64_architecture_interrupt_handler (
+    aarch64_architecture_exception_frame_t* frame __attribute__ ((unused)))
+{
+  aarch64_architecture_bkpt ();
+}
+
+__attribute__ ((weak)) aarch64_architecture_exception_full_frame_t*
+aarch64_architecture_interrupt_context_switch (
+    aarch64_architecture_exception_full_frame_t* frame)
+{
+  // No scheduler, resume the interrupted context.
+  return frame;
+}
+
+__attribute__ ((weak)) void
+aarch64_architecture_exception_handler (
+    aarch64_architecture_exception_full_frame_t* frame
+    __attribute__ ((unused)),
+    uint32_t kind __attribute__ ((unused)))
+{
+  aarch64_architecture_bkpt ();
+  while (true)
+    {
+      aarch64_architecture_wfi ();
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(MICRO_OS_PLUS_INCLUDE_EXCEPTION_VECTORS)
+
+// ----------------------------------------------------------------------------
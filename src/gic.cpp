@@ -0,0 +1,441 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_INCLUDE_CONFIG_H)
+#include <micro-os-plus/config.h>
+#endif // MICRO_OS_PLUS_INCLUDE_CONFIG_H
+
+#include <micro-os-plus/architecture.h>
+
+#if defined(MICRO_OS_PLUS_INCLUDE_GIC)
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+  struct entry_s
+  {
+    aarch64_architecture_gic_handler_t handler;
+    void* arg;
+  };
+
+  // Indexed by INTID, no search on the interrupt path.
+  entry_s handlers[MICRO_OS_PLUS_INTEGER_GIC_MAX_INTERRUPTS];
+
+  // The RD_base of each core, found by affinity.
+  uintptr_t redistributors[MICRO_OS_PLUS_INTEGER_SMP_MAX_CORES];
+
+#if defined(MICRO_OS_PLUS_USE_GIC_NESTED_INTERRUPTS)
+  uint32_t nesting[MICRO_OS_PLUS_INTEGER_SMP_MAX_CORES];
+  uint32_t deferred_context_switch[MICRO_OS_PLUS_INTEGER_SMP_MAX_CORES];
+#endif // defined(MICRO_OS_PLUS_USE_GIC_NESTED_INTERRUPTS)
+
+  inline volatile uint32_t&
+  register_32 (uintptr_t address)
+  {
+    return *reinterpret_cast<volatile uint32_t*> (address);
+  }
+
+  inline volatile uint64_t&
+  register_64 (uintptr_t address)
+  {
+    return *reinterpret_cast<volatile uint64_t*> (address);
+  }
+
+  inline volatile uint32_t&
+  gicd (uintptr_t offset)
+  {
+    return register_32 (MICRO_OS_PLUS_INTEGER_GIC_DISTRIBUTOR_ADDRESS
+                        + offset);
+  }
+
+  void
+  wait_distributor (void)
+  {
+    while (gicd (AARCH64_GICD_CTLR) & AARCH64_GICD_CTLR_RWP)
+      {
+      }
+  }
+
+  void
+  wait_redistributor (uintptr_t rd_base)
+  {
+    while (register_32 (rd_base + AARCH64_GICR_CTLR) & AARCH64_GICR_CTLR_RWP)
+      {
+      }
+  }
+
+  uintptr_t
+  find_redistributor (void)
+  {
+    // GICR_TYPER[63:32] has the affinity as Aff3.Aff2.Aff1.Aff0.
+    aarch64_architecture_register_t mpidr = aarch64_architecture_get_mpidr ();
+    uint64_t affinity = (((mpidr >> 32) & 0xFF) << 24) | (mpidr & 0xFFFFFF);
+
+    for (uintptr_t rd_base = MICRO_OS_PLUS_INTEGER_GIC_REDISTRIBUTOR_ADDRESS;;
+         rd_base += AARCH64_GICR_STRIDE)
+      {
+        uint64_t typer = register_64 (rd_base + AARCH64_GICR_TYPER);
+        if ((typer >> 32) == affinity)
+          {
+            return rd_base;
+          }
+        if (typer & AARCH64_GICR_TYPER_LAST)
+          {
+            return 0;
+          }
+      }
+  }
+
+  // SGIs and PPIs are configured in the redistributor of the current
+  // core, SPIs in the distributor; the register layouts are the same.
+  uintptr_t
+  base_of (uint32_t intid)
+  {
+    if (intid < AARCH64_GIC_SPI_FIRST)
+      {
+        return redistributors[aarch64_architecture_get_core_id ()]
+               + AARCH64_GICR_SGI_BASE;
+      }
+    return MICRO_OS_PLUS_INTEGER_GIC_DISTRIBUTOR_ADDRESS;
+  }
+
+  // For the registers with one bit per INTID.
+  inline volatile uint32_t&
+  bit_register (uint32_t intid, uintptr_t offset)
+  {
+    return register_32 (base_of (intid) + offset + (intid / 32) * 4);
+  }
+
+  inline uint32_t
+  bit_mask (uint32_t intid)
+  {
+    return 1U << (intid % 32);
+  }
+
+  void
+  wait_for (uint32_t intid)
+  {
+    if (intid < AARCH64_GIC_SPI_FIRST)
+      {
+        wait_redistributor (
+            redistributors[aarch64_architecture_get_core_id ()]);
+      }
+    else
+      {
+        wait_distributor ();
+      }
+  }
+
+  void
+  enable_system_registers (void)
+  {
+    uint64_t sre;
+
+    __asm__ volatile(
+
+        " mrs %[sre], icc_sre_el1 \n"
+        " orr %[sre], %[sre], %[bit] \n"
+        " msr icc_sre_el1, %[sre] \n"
+        " isb \n"
+
+        : [sre] "=&r"(sre) /* Outputs */
+        : [bit] "i"(AARCH64_ICC_SRE_SRE) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  void
+  enable_group_1 (void)
+  {
+    __asm__ volatile(
+
+        " msr icc_igrpen1_el1, %[enable] \n"
+        " isb \n"
+
+        : /* Outputs */
+        : [enable] "r"(1UL) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+void
+aarch64_architecture_gic_initialize (void)
+{
+  // Clearing ARE once set is UNPREDICTABLE; only the groups are
+  // disabled, then affinity routing is enabled, before IROUTER is
+  // written.
+  gicd (AARCH64_GICD_CTLR)
+      = gicd (AARCH64_GICD_CTLR)
+        & ~(AARCH64_GICD_CTLR_ENABLE_GRP0 | AARCH64_GICD_CTLR_ENABLE_GRP1);
+  wait_distributor ();
+  gicd (AARCH64_GICD_CTLR) = AARCH64_GICD_CTLR_ARE;
+  wait_distributor ();
+
+  uint32_t lines = ((gicd (AARCH64_GICD_TYPER) & 0x1F) + 1) * 32;
+  if (lines > AARCH64_GIC_SPURIOUS_FIRST)
+    {
+      lines = AARCH64_GIC_SPURIOUS_FIRST;
+    }
+
+  // All SPIs disabled, inactive, in Group 1, level-sensitive,
+  // at the default priority and routed to the current core.
+  for (uint32_t intid = AARCH64_GIC_SPI_FIRST; intid < lines; intid += 32)
+    {
+      uintptr_t offset = (intid / 32) * 4;
+      gicd (AARCH64_GICD_ICENABLER + offset) = 0xFFFFFFFF;
+      gicd (AARCH64_GICD_ICPENDR + offset) = 0xFFFFFFFF;
+      gicd (AARCH64_GICD_ICACTIVER + offset) = 0xFFFFFFFF;
+      gicd (AARCH64_GICD_IGROUPR + offset) = 0xFFFFFFFF;
+      gicd (AARCH64_GICD_IGRPMODR + offset) = 0;
+    }
+  for (uint32_t intid = AARCH64_GIC_SPI_FIRST; intid < lines; intid += 16)
+    {
+      gicd (AARCH64_GICD_ICFGR + (intid / 16) * 4) = 0;
+    }
+
+  aarch64_architecture_register_t mpidr = aarch64_architecture_get_mpidr ();
+  for (uint32_t intid = AARCH64_GIC_SPI_FIRST; intid < lines; ++intid)
+    {
+      *reinterpret_cast<volatile uint8_t*> (
+          MICRO_OS_PLUS_INTEGER_GIC_DISTRIBUTOR_ADDRESS
+          + AARCH64_GICD_IPRIORITYR + intid)
+          = MICRO_OS_PLUS_INTEGER_GIC_DEFAULT_PRIORITY;
+      aarch64_architecture_gic_set_affinity (intid, mpidr);
+    }
+  wait_distributor ();
+
+  gicd (AARCH64_GICD_CTLR)
+      = AARCH64_GICD_CTLR_ARE | AARCH64_GICD_CTLR_ENABLE_GRP1;
+  wait_distributor ();
+
+  aarch64_architecture_gic_cpu_initialize ();
+}
+
+void
+aarch64_architecture_gic_cpu_initialize (void)
+{
+  uintptr_t rd_base = find_redistributor ();
+  if (rd_base == 0)
+    {
+      aarch64_architecture_bkpt (); // Not a GICv3, or wrong address.
+      return;
+    }
+  redistributors[aarch64_architecture_get_core_id ()] = rd_base;
+
+  // Wake up the redistributor.
+  volatile uint32_t& waker = register_32 (rd_base + AARCH64_GICR_WAKER);
+  waker = waker & ~AARCH64_GICR_WAKER_PROCESSOR_SLEEP;
+  while (waker & AARCH64_GICR_WAKER_CHILDREN_ASLEEP)
+    {
+    }
+
+  // SGIs and PPIs, as the SPIs in the distributor.
+  uintptr_t sgi_base = rd_base + AARCH64_GICR_SGI_BASE;
+  register_32 (sgi_base + AARCH64_GICD_ICENABLER) = 0xFFFFFFFF;
+  register_32 (sgi_base + AARCH64_GICD_ICPENDR) = 0xFFFFFFFF;
+  register_32 (sgi_base + AARCH64_GICD_ICACTIVER) = 0xFFFFFFFF;
+  register_32 (sgi_base + AARCH64_GICD_IGROUPR) = 0xFFFFFFFF;
+  register_32 (sgi_base + AARCH64_GICD_IGRPMODR) = 0;
+  register_32 (sgi_base + AARCH64_GICD_ICFGR + 4) = 0; // PPIs
+  for (uint32_t intid = 0; intid < AARCH64_GIC_SPI_FIRST; ++intid)
+    {
+      *reinterpret_cast<volatile uint8_t*> (
+          sgi_base + AARCH64_GICD_IPRIORITYR + intid)
+          = MICRO_OS_PLUS_INTEGER_GIC_DEFAULT_PRIORITY;
+    }
+  wait_redistributor (rd_base);
+
+  // The CPU interface, via the system registers only.
+  enable_system_registers ();
+  aarch64_architecture_gic_set_priority_mask (0xFF);
+  aarch64_architecture_gic_set_binary_point (0);
+  enable_group_1 ();
+}
+
+bool
+aarch64_architecture_gic_set_handler (
+    uint32_t intid, aarch64_architecture_gic_handler_t handler, void* arg)
+{
+  if (intid >= MICRO_OS_PLUS_INTEGER_GIC_MAX_INTERRUPTS)
+    {
+      return false;
+    }
+
+  // The dispatch may run on another core; make the argument visible
+  // before the handler.
+  handlers[intid].arg = arg;
+  aarch64_architecture_dmb_ishst ();
+  handlers[intid].handler = handler;
+
+  return true;
+}
+
+void
+aarch64_architecture_gic_enable (uint32_t intid)
+{
+  bit_register (intid, AARCH64_GICD_ISENABLER) = bit_mask (intid);
+}
+
+void
+aarch64_architecture_gic_disable (uint32_t intid)
+{
+  bit_register (intid, AARCH64_GICD_ICENABLER) = bit_mask (intid);
+  wait_for (intid);
+}
+
+void
+aarch64_architecture_gic_set_priority (uint32_t intid, uint32_t priority)
+{
+  *reinterpret_cast<volatile uint8_t*> (base_of (intid)
+                                        + AARCH64_GICD_IPRIORITYR + intid)
+      = static_cast<uint8_t> (priority);
+}
+
+void
+aarch64_architecture_gic_set_edge_triggered (uint32_t intid, bool edge)
+{
+  if (intid < AARCH64_GIC_PPI_FIRST)
+    {
+      return; // SGIs are always edge-triggered.
+    }
+
+  volatile uint32_t& icfgr = register_32 (
+      base_of (intid) + AARCH64_GICD_ICFGR + (intid / 16) * 4);
+  uint32_t mask = 2U << ((intid % 16) * 2);
+  if (edge)
+    {
+      icfgr = icfgr | mask;
+    }
+  else
+    {
+      icfgr = icfgr & ~mask;
+    }
+}
+
+void
+aarch64_architecture_gic_set_affinity (uint32_t intid,
+                                       aarch64_architecture_register_t mpidr)
+{
+  if (intid < AARCH64_GIC_SPI_FIRST)
+    {
+      return; // SGIs and PPIs are private to each core.
+    }
+
+  // The same layout as MPIDR_EL1, without the MT/U bits.
+  register_64 (MICRO_OS_PLUS_INTEGER_GIC_DISTRIBUTOR_ADDRESS
+               + AARCH64_GICD_IROUTER + intid * 8)
+      = mpidr & 0xFF00FFFFFFULL;
+}
+
+void
+aarch64_architecture_gic_set_affinity_any (uint32_t intid)
+{
+  if (intid < AARCH64_GIC_SPI_FIRST)
+    {
+      return;
+    }
+
+  register_64 (MICRO_OS_PLUS_INTEGER_GIC_DISTRIBUTOR_ADDRESS
+               + AARCH64_GICD_IROUTER + intid * 8)
+      = AARCH64_GICD_IROUTER_ANY;
+}
+
+void
+aarch64_architecture_gic_set_pending (uint32_t intid)
+{
+  bit_register (intid, AARCH64_GICD_ISPENDR) = bit_mask (intid);
+}
+
+void
+aarch64_architecture_gic_clear_pending (uint32_t intid)
+{
+  bit_register (intid, AARCH64_GICD_ICPENDR) = bit_mask (intid);
+}
+
+void
+aarch64_architecture_gic_dispatch (
+    aarch64_architecture_exception_frame_t* frame)
+{
+  uint32_t iar = aarch64_architecture_gic_acknowledge ();
+  uint32_t intid = iar & 0xFFFFFF;
+  if (intid >= AARCH64_GIC_SPURIOUS_FIRST)
+    {
+      return; // Spurious, no end of interrupt.
+    }
+
+  aarch64_architecture_gic_handler_t handler = nullptr;
+  void* arg = nullptr;
+  if (intid < MICRO_OS_PLUS_INTEGER_GIC_MAX_INTERRUPTS)
+    {
+      handler = handlers[intid].handler;
+      arg = handlers[intid].arg;
+    }
+
+  if (handler == nullptr)
+    {
+      // Prevent an interrupt storm; the special INTIDs have no enable.
+      if (intid < AARCH64_GIC_SPURIOUS_FIRST)
+        {
+          aarch64_architecture_gic_disable (intid);
+        }
+      aarch64_architecture_gic_end_of_interrupt (iar);
+      return;
+    }
+
+#if defined(MICRO_OS_PLUS_USE_GIC_NESTED_INTERRUPTS)
+  uint32_t core = aarch64_architecture_get_core_id ();
+  ++nesting[core];
+
+  // The running priority masks the interrupts of the same or lower
+  // priority; the others may preempt the handler.
+  aarch64_architecture_interrupts_enable ();
+  handler (arg, frame);
+  aarch64_architecture_interrupts_disable ();
+
+  // Only the outermost level may switch the context.
+  if (--nesting[core] != 0)
+    {
+      deferred_context_switch[core]
+          |= aarch64_architecture_interrupts_take_context_switch_request ();
+    }
+  else if (deferred_context_switch[core] != 0)
+    {
+      deferred_context_switch[core] = 0;
+      aarch64_architecture_interrupts_request_context_switch ();
+    }
+#else
+  handler (arg, frame);
+#endif // defined(MICRO_OS_PLUS_USE_GIC_NESTED_INTERRUPTS)
+
+  aarch64_architecture_gic_end_of_interrupt (iar);
+}
+
+// ----------------------------------------------------------------------------
+
+void
+aarch64_architecture_interrupt_handler (
+    aarch64_architecture_exception_frame_t* frame)
+{
+  aarch64_architecture_gic_dispatch (frame);
+}
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(MICRO_OS_PLUS_INCLUDE_GIC)
+
+// ----------------------------------------------------------------------------
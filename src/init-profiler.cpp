@@ -0,0 +1,219 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_INCLUDE_CONFIG_H)
+#include <micro-os-plus/config.h>
+#endif // MICRO_OS_PLUS_INCLUDE_CONFIG_H
+
+#include <micro-os-plus/architecture.h>
+
+#if defined(MICRO_OS_PLUS_INCLUDE_INIT_PROFILER)
+
+// ----------------------------------------------------------------------------
+
+extern "C"
+{
+  typedef void (*init_function_t) (void);
+
+  // Defined by the linker script.
+  extern init_function_t __preinit_array_start[];
+  extern init_function_t __preinit_array_end[];
+  extern init_function_t __init_array_start[];
+  extern init_function_t __init_array_end[];
+
+  // The ends of the sysinit and platform buckets; not defined by
+  // older linker scripts.
+  extern init_function_t __preinit_array_sysinit_end[]
+      __attribute__ ((weak));
+  extern init_function_t __preinit_array_platform_end[]
+      __attribute__ ((weak));
+
+  void
+  _init (void);
+}
+
+namespace
+{
+  aarch64_architecture_init_profiler_entry_t
+      table[MICRO_OS_PLUS_INTEGER_INIT_PROFILER_ENTRIES];
+
+  volatile uint64_t entries_count;
+
+  // The counter when the run began; the entries are relative to it.
+  uint64_t base;
+
+  void
+  run (init_function_t* begin, init_function_t* end, uint32_t kind)
+  {
+    for (init_function_t* p = begin; p < end; ++p)
+      {
+        uint64_t before = aarch64_architecture_generic_timer_get_counter ();
+        (*p) ();
+        aarch64_architecture_init_profiler_record (
+            kind, reinterpret_cast<uintptr_t> (*p), before,
+            aarch64_architecture_generic_timer_get_counter ());
+      }
+  }
+
+  const char*
+  kind_name (uint32_t kind)
+  {
+    static const char* const names[] = {
+      "sysinit", "platform", "preinit", "_init", "init_array", "lazy",
+    };
+
+    return (kind < sizeof (names) / sizeof (names[0])) ? names[kind] : "?";
+  }
+
+  using stream_t = aarch64::architecture::semihosting::stream<>;
+
+  // Without printf(), which may not be initialised at this point.
+  bool
+  put_number (stream_t& stream, uint64_t value, unsigned int radix)
+  {
+    char buffer[24];
+    char* p = buffer + sizeof (buffer);
+    *--p = '\0';
+    do
+      {
+        *--p = "0123456789abcdef"[value % radix];
+        value /= radix;
+      }
+    while (value != 0);
+    if (radix == 16)
+      {
+        *--p = 'x';
+        *--p = '0';
+      }
+
+    return stream.puts (p) >= 0;
+  }
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+void
+aarch64_architecture_init_profiler_init_array (void)
+{
+  base = aarch64_architecture_generic_timer_get_counter ();
+
+  init_function_t* sysinit_end = (__preinit_array_sysinit_end != nullptr)
+                                     ? __preinit_array_sysinit_end
+                                     : __preinit_array_start;
+  init_function_t* platform_end = (__preinit_array_platform_end != nullptr)
+                                      ? __preinit_array_platform_end
+                                      : sysinit_end;
+
+  run (__preinit_array_start, sysinit_end,
+       AARCH64_INIT_PROFILER_KIND_SYSINIT);
+  run (sysinit_end, platform_end, AARCH64_INIT_PROFILER_KIND_PLATFORM);
+  run (platform_end, __preinit_array_end,
+       AARCH64_INIT_PROFILER_KIND_PREINIT);
+
+  uint64_t before = aarch64_architecture_generic_timer_get_counter ();
+  _init ();
+  aarch64_architecture_init_profiler_record (
+      AARCH64_INIT_PROFILER_KIND_INIT, reinterpret_cast<uintptr_t> (&_init),
+      before, aarch64_architecture_generic_timer_get_counter ());
+
+  run (__init_array_start, __init_array_end,
+       AARCH64_INIT_PROFILER_KIND_INIT_ARRAY);
+}
+
+void
+aarch64_architecture_init_profiler_record (uint32_t kind, uintptr_t address,
+                                           uint64_t begin, uint64_t end)
+{
+  // Lazy constructors may run on several cores.
+  uint64_t index
+      = aarch64_architecture_atomic_fetch_add_64 (&entries_count, 1);
+  if (index >= MICRO_OS_PLUS_INTEGER_INIT_PROFILER_ENTRIES)
+    {
+      return;
+    }
+
+  aarch64_architecture_init_profiler_entry_t* entry = &table[index];
+  entry->address = address;
+  entry->begin = begin - base;
+  entry->ticks = end - begin;
+  entry->kind = kind;
+}
+
+const aarch64_architecture_init_profiler_entry_t*
+aarch64_architecture_init_profiler_get_entries (void)
+{
+  return table;
+}
+
+size_t
+aarch64_architecture_init_profiler_get_count (void)
+{
+  uint64_t count = entries_count;
+  return (count < MICRO_OS_PLUS_INTEGER_INIT_PROFILER_ENTRIES)
+             ? static_cast<size_t> (count)
+             : MICRO_OS_PLUS_INTEGER_INIT_PROFILER_ENTRIES;
+}
+
+size_t
+aarch64_architecture_init_profiler_get_dropped_count (void)
+{
+  return static_cast<size_t> (entries_count)
+         - aarch64_architecture_init_profiler_get_count ();
+}
+
+int
+aarch64_architecture_init_profiler_write (const char* path)
+{
+  stream_t stream{ path, AARCH64_SEMIHOSTING_OPEN_WRITE };
+  if (!stream.is_open ())
+    {
+      return -1;
+    }
+
+#if defined(MICRO_OS_PLUS_INCLUDE_CLOCK)
+  bool ok = stream.puts ("kind,address,begin,ticks,ns\n") >= 0;
+#else
+  bool ok = stream.puts ("kind,address,begin,ticks\n") >= 0;
+#endif // defined(MICRO_OS_PLUS_INCLUDE_CLOCK)
+
+  size_t count = aarch64_architecture_init_profiler_get_count ();
+  for (size_t i = 0; ok && i < count; ++i)
+    {
+      const aarch64_architecture_init_profiler_entry_t* entry = &table[i];
+
+      ok = stream.puts (kind_name (entry->kind)) >= 0;
+      ok = ok && stream.putc (',') >= 0;
+      ok = ok && put_number (stream, entry->address, 16);
+      ok = ok && stream.putc (',') >= 0;
+      ok = ok && put_number (stream, entry->begin, 10);
+      ok = ok && stream.putc (',') >= 0;
+      ok = ok && put_number (stream, entry->ticks, 10);
+#if defined(MICRO_OS_PLUS_INCLUDE_CLOCK)
+      uint64_t ns = aarch64_architecture_clock_ticks_to_ns (entry->ticks);
+      ok = ok && stream.putc (',') >= 0;
+      ok = ok && put_number (stream, ns, 10);
+#endif // defined(MICRO_OS_PLUS_INCLUDE_CLOCK)
+      ok = ok && stream.putc ('\n') >= 0;
+    }
+
+  ok = stream.close () && ok;
+
+  return ok ? 0 : -1;
+}
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(MICRO_OS_PLUS_INCLUDE_INIT_PROFILER)
+
+// ----------------------------------------------------------------------------
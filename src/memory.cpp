@@ -0,0 +1,338 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_INCLUDE_CONFIG_H)
+#include <micro-os-plus/config.h>
+#endif // MICRO_OS_PLUS_INCLUDE_CONFIG_H
+
+#include <micro-os-plus/architecture.h>
+
+#if defined(MICRO_OS_PLUS_INCLUDE_MEMORY)
+
+#include <unistd.h>
+
+// ----------------------------------------------------------------------------
+
+static_assert ((MICRO_OS_PLUS_INTEGER_MEMORY_SPAN_SIZE
+                & (MICRO_OS_PLUS_INTEGER_MEMORY_SPAN_SIZE - 1))
+                   == 0,
+               "MICRO_OS_PLUS_INTEGER_MEMORY_SPAN_SIZE must be a power of 2");
+
+namespace
+{
+  constexpr uintptr_t span_size = MICRO_OS_PLUS_INTEGER_MEMORY_SPAN_SIZE;
+  constexpr uint32_t classes = MICRO_OS_PLUS_INTEGER_MEMORY_SIZE_CLASSES;
+  constexpr uint32_t max_cores = MICRO_OS_PLUS_INTEGER_SMP_MAX_CORES;
+
+  // In the first cache line of each span.
+  struct span_header
+  {
+    uint32_t core;
+    uint32_t size_class;
+  };
+
+  struct alignas (MICRO_OS_PLUS_INTEGER_CACHE_LINE_SIZE) core_pools
+  {
+    // The free lists, used only by the owner core, with the interrupts
+    // masked; the first word of each free block links to the next one.
+    uintptr_t local[classes];
+
+    // Blocks freed by the other cores, on a different cache line.
+    alignas (MICRO_OS_PLUS_INTEGER_CACHE_LINE_SIZE) volatile uint64_t
+        remote[classes];
+  };
+
+  core_pools pools[max_cores];
+
+  // The region; the arenas take memory from the bottom, the pools from
+  // the top, both offsets are updated at once, with a compare-and-swap:
+  // low offset in bits 0-31, high offset in bits 32-63.
+  uintptr_t region_begin;
+  volatile uint64_t region_offsets;
+
+  uintptr_t line_size;
+  uint32_t line_shift;
+  uint32_t size_classes;
+
+  constexpr uint64_t
+  pack (uint64_t low, uint64_t high)
+  {
+    return low | (high << 32);
+  }
+
+  // Take `size` bytes, `alignment` aligned, from the bottom or the top
+  // of the region.
+  uintptr_t
+  reserve (size_t size, uintptr_t alignment, bool from_top)
+  {
+    uint64_t offsets
+        = aarch64_architecture_load_acquire_64 (&region_offsets);
+    for (;;)
+      {
+        uint64_t low = offsets & 0xFFFFFFFF;
+        uint64_t high = offsets >> 32;
+        uintptr_t address;
+        uint64_t desired;
+        if (from_top)
+          {
+            address = (region_begin + high - size) & ~(alignment - 1);
+            if (high < size || address < region_begin + low)
+              {
+                return 0;
+              }
+            desired = pack (low, address - region_begin);
+          }
+        else
+          {
+            address = (region_begin + low + alignment - 1)
+                      & ~(alignment - 1);
+            if (address + size > region_begin + high)
+              {
+                return 0;
+              }
+            desired = pack (address + size - region_begin, high);
+          }
+
+        uint64_t old = aarch64_architecture_atomic_compare_exchange_64 (
+            &region_offsets, offsets, desired);
+        if (old == offsets)
+          {
+            return address;
+          }
+        offsets = old;
+      }
+  }
+
+  // A new span, with its blocks linked; return the first one.
+  uintptr_t
+  refill (uint32_t core, uint32_t size_class)
+  {
+    uintptr_t span = reserve (span_size, span_size, true);
+    if (span == 0)
+      {
+        return 0;
+      }
+
+    span_header* header = reinterpret_cast<span_header*> (span);
+    header->core = core;
+    header->size_class = size_class;
+
+    uintptr_t block_size = line_size << size_class;
+    uintptr_t first = span + line_size;
+    uintptr_t last = span + span_size - block_size;
+    // Round down to a block boundary, relative to the first block.
+    last = first + ((last - first) / block_size) * block_size;
+    for (uintptr_t block = first; block < last; block += block_size)
+      {
+        *reinterpret_cast<uintptr_t*> (block) = block + block_size;
+      }
+    *reinterpret_cast<uintptr_t*> (last) = 0;
+
+    return first;
+  }
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+int
+aarch64_architecture_memory_initialize (void* begin, size_t size)
+{
+  line_size = aarch64_architecture_dcache_get_line_size ();
+  line_shift = static_cast<uint32_t> (__builtin_ctzll (line_size));
+
+  // The largest blocks must fit at least twice in a span.
+  size_classes = 0;
+  while (size_classes < classes
+         && (line_size << size_classes) * 2 <= span_size - line_size)
+    {
+      ++size_classes;
+    }
+
+  uintptr_t first = (reinterpret_cast<uintptr_t> (begin) + line_size - 1)
+                    & ~(line_size - 1);
+  uintptr_t end = reinterpret_cast<uintptr_t> (begin) + size;
+  if (end < first + span_size || end - first > 0xFFFFFFFF)
+    {
+      return -1;
+    }
+
+  for (uint32_t core = 0; core < max_cores; ++core)
+    {
+      for (uint32_t k = 0; k < classes; ++k)
+        {
+          pools[core].local[k] = 0;
+          pools[core].remote[k] = 0;
+        }
+    }
+
+  region_begin = first;
+  aarch64_architecture_store_release_64 (&region_offsets,
+                                         pack (0, end - first));
+
+  return 0;
+}
+
+int
+aarch64_architecture_memory_initialize_heap (size_t size)
+{
+  void* begin = sbrk (static_cast<ptrdiff_t> (size));
+  if (begin == reinterpret_cast<void*> (-1))
+    {
+      return -1;
+    }
+
+  return aarch64_architecture_memory_initialize (begin, size);
+}
+
+size_t
+aarch64_architecture_memory_get_line_size (void)
+{
+  return line_size;
+}
+
+size_t
+aarch64_architecture_memory_get_max_block_size (void)
+{
+  return (size_classes == 0) ? 0 : line_size << (size_classes - 1);
+}
+
+size_t
+aarch64_architecture_memory_get_free (void)
+{
+  uint64_t offsets = aarch64_architecture_load_acquire_64 (&region_offsets);
+  return static_cast<size_t> ((offsets >> 32) - (offsets & 0xFFFFFFFF));
+}
+
+void*
+aarch64_architecture_memory_allocate (size_t size)
+{
+  // Also prevents the rounding below from overflowing.
+  if (size > aarch64_architecture_memory_get_max_block_size ())
+    {
+      return nullptr;
+    }
+
+  // The smallest power of 2 number of lines.
+  uint64_t lines = (size + line_size - 1) >> line_shift;
+  uint32_t size_class
+      = (lines <= 1)
+            ? 0
+            : static_cast<uint32_t> (64 - __builtin_clzll (lines - 1));
+
+  // The thread may migrate while interrupts are enabled, so the core
+  // is read only after they are disabled.
+  aarch64_architecture_register_t daif
+      = aarch64_architecture_interrupts_save_and_disable ();
+
+  uint32_t core = aarch64_architecture_get_core_id ();
+  if (core >= max_cores)
+    {
+      aarch64_architecture_interrupts_restore (daif);
+      return nullptr;
+    }
+
+  core_pools* pool = &pools[core];
+
+  uintptr_t block = pool->local[size_class];
+  if (block == 0)
+    {
+      // Take all the blocks freed by the other cores at once; only
+      // the owner removes blocks from this list, so there is no ABA.
+      block = static_cast<uintptr_t> (
+          aarch64_architecture_atomic_swap_64 (&pool->remote[size_class], 0));
+      if (block == 0)
+        {
+          block = refill (core, size_class);
+          if (block == 0)
+            {
+              aarch64_architecture_interrupts_restore (daif);
+              return nullptr;
+            }
+        }
+    }
+  pool->local[size_class] = *reinterpret_cast<uintptr_t*> (block);
+
+  aarch64_architecture_interrupts_restore (daif);
+
+  return reinterpret_cast<void*> (block);
+}
+
+void
+aarch64_architecture_memory_free (void* block)
+{
+  if (block == nullptr)
+    {
+      return;
+    }
+
+  uintptr_t address = reinterpret_cast<uintptr_t> (block);
+  const span_header* header
+      = reinterpret_cast<const span_header*> (address & ~(span_size - 1));
+  uint32_t size_class = header->size_class;
+  core_pools* pool = &pools[header->core];
+
+  aarch64_architecture_register_t daif
+      = aarch64_architecture_interrupts_save_and_disable ();
+
+  if (header->core == aarch64_architecture_get_core_id ())
+    {
+      *reinterpret_cast<uintptr_t*> (address) = pool->local[size_class];
+      pool->local[size_class] = address;
+
+      aarch64_architecture_interrupts_restore (daif);
+      return;
+    }
+
+  aarch64_architecture_interrupts_restore (daif);
+
+  // The compare-and-swap also releases the link.
+  volatile uint64_t* head = &pool->remote[size_class];
+  uint64_t expected = aarch64_architecture_load_acquire_64 (head);
+  for (;;)
+    {
+      *reinterpret_cast<uintptr_t*> (address)
+          = static_cast<uintptr_t> (expected);
+      uint64_t old = aarch64_architecture_atomic_compare_exchange_64 (
+          head, expected, address);
+      if (old == expected)
+        {
+          return;
+        }
+      expected = old;
+    }
+}
+
+int
+aarch64_architecture_memory_arena_initialize (
+    aarch64_architecture_memory_arena_t* arena, size_t size)
+{
+  uintptr_t begin = reserve (size, line_size, false);
+  if (begin == 0)
+    {
+      return -1;
+    }
+
+  arena->begin = begin;
+  arena->current = begin;
+  arena->end = begin + size;
+  arena->alignment = line_size;
+
+  return 0;
+}
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(MICRO_OS_PLUS_INCLUDE_MEMORY)
+
+// ----------------------------------------------------------------------------
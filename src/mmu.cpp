@@ -0,0 +1,423 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_INCLUDE_CONFIG_H)
+#include <micro-os-plus/config.h>
+#endif // MICRO_OS_PLUS_INCLUDE_CONFIG_H
+
+#include <micro-os-plus/architecture.h>
+
+#include <cstddef>
+
+#if defined(MICRO_OS_PLUS_INCLUDE_MMU)
+
+// ----------------------------------------------------------------------------
+
+using namespace aarch64::architecture;
+
+static_assert (mmu::attributes<mmu::memory_type::normal,
+                               mmu::access::read_execute> ()
+                   == AARCH64_MMU_ATTRIBUTES_CODE,
+               "Adjust AARCH64_MMU_ATTRIBUTES_CODE");
+static_assert (
+    mmu::attributes<mmu::memory_type::normal, mmu::access::read_only> ()
+        == AARCH64_MMU_ATTRIBUTES_RODATA,
+    "Adjust AARCH64_MMU_ATTRIBUTES_RODATA");
+static_assert (
+    mmu::attributes<mmu::memory_type::normal, mmu::access::read_write> ()
+        == AARCH64_MMU_ATTRIBUTES_DATA,
+    "Adjust AARCH64_MMU_ATTRIBUTES_DATA");
+static_assert (mmu::attributes<mmu::memory_type::normal,
+                               mmu::access::user_read_execute> ()
+                   == AARCH64_MMU_ATTRIBUTES_USER_CODE,
+               "Adjust AARCH64_MMU_ATTRIBUTES_USER_CODE");
+static_assert (mmu::attributes<mmu::memory_type::normal,
+                               mmu::access::user_read_write> ()
+                   == AARCH64_MMU_ATTRIBUTES_USER_DATA,
+               "Adjust AARCH64_MMU_ATTRIBUTES_USER_DATA");
+static_assert (
+    mmu::attributes<mmu::memory_type::device, mmu::access::read_write> ()
+        == AARCH64_MMU_ATTRIBUTES_DEVICE,
+    "Adjust AARCH64_MMU_ATTRIBUTES_DEVICE");
+
+extern "C"
+{
+  // Defined by the linker script; all 4 KB aligned.
+  extern char __vectors_start[];
+  extern char __etext[];
+  extern char __data_start__[];
+  extern char __stack[];
+
+  // Not defined by older linker scripts.
+  extern char __rodata_end__[] __attribute__ ((weak));
+  extern char __fast_text_start__[] __attribute__ ((weak));
+  extern char __fast_text_end__[] __attribute__ ((weak));
+  extern char __fast_data_start__[] __attribute__ ((weak));
+  extern char __fast_data_end__[] __attribute__ ((weak));
+}
+
+namespace
+{
+  constexpr std::size_t table_entries = 512;
+
+  constexpr unsigned int level1_shift = 30; // 1 GB
+  constexpr unsigned int level2_shift = 21; // 2 MB
+  constexpr unsigned int level3_shift = 12; // 4 KB
+
+  constexpr uintptr_t page_size = 1ULL << level3_shift;
+  constexpr uintptr_t address_space_end = 1ULL << 39;
+
+  constexpr uint64_t descriptor_valid = 0x1;
+  constexpr uint64_t descriptor_type_mask = 0x3;
+  constexpr uint64_t descriptor_block = 0x1;
+  constexpr uint64_t descriptor_table = 0x3;
+  constexpr uint64_t descriptor_page = 0x3;
+  constexpr uint64_t descriptor_address_mask = 0x0000FFFFFFFFF000ULL;
+
+  // TCR_EL1 fields.
+  constexpr uint64_t tcr_t0sz = 64 - 39;
+  constexpr uint64_t tcr_irgn0_wbwa = 1ULL << 8;
+  constexpr uint64_t tcr_orgn0_wbwa = 1ULL << 10;
+  constexpr uint64_t tcr_sh0_inner = 3ULL << 12;
+  constexpr uint64_t tcr_tg0_4k = 0ULL << 14;
+  constexpr uint64_t tcr_epd1 = 1ULL << 23;
+  constexpr unsigned int tcr_ips_shift = 32;
+
+  // Built before .bss is cleared, so they must not live there.
+  __attribute__ ((section (".noinit"), aligned (page_size)))
+  uint64_t tables[MICRO_OS_PLUS_INTEGER_MMU_TABLES][table_entries];
+
+  __attribute__ ((section (".noinit"))) std::size_t tables_used;
+
+  // --------------------------------------------------------------------------
+
+  volatile uint64_t*
+  allocate_table (void)
+  {
+    if (tables_used >= MICRO_OS_PLUS_INTEGER_MMU_TABLES)
+      {
+        return nullptr;
+      }
+
+    volatile uint64_t* table = tables[tables_used++];
+
+    // Volatile stores, so the compiler does not call memset(), which
+    // may use `dc zva`, not allowed while memory is still Device.
+    for (std::size_t i = 0; i < table_entries; ++i)
+      {
+        table[i] = 0;
+      }
+
+    return table;
+  }
+
+  // Return the next level table pointed by the entry, creating it
+  // if the entry is still invalid.
+  volatile uint64_t*
+  get_next_table (volatile uint64_t* entry)
+  {
+    uint64_t descriptor = *entry;
+    if ((descriptor & descriptor_type_mask) == descriptor_table)
+      {
+        return reinterpret_cast<volatile uint64_t*> (
+            static_cast<uintptr_t> (descriptor & descriptor_address_mask));
+      }
+
+    if (descriptor & descriptor_valid)
+      {
+        return nullptr; // Already mapped by a block; overlapping ranges.
+      }
+
+    volatile uint64_t* table = allocate_table ();
+    if (table != nullptr)
+      {
+        *entry = reinterpret_cast<uintptr_t> (table) | descriptor_table;
+      }
+
+    return table;
+  }
+
+  constexpr std::size_t
+  table_index (uintptr_t address, unsigned int shift)
+  {
+    return (address >> shift) & (table_entries - 1);
+  }
+
+  // With flash images the read-only data ends before the RAM.
+  const char*
+  get_rodata_end (void)
+  {
+    return (__rodata_end__ != nullptr) ? __rodata_end__ : __data_start__;
+  }
+
+  // A fast memory section with its own mapping; not if empty or
+  // already covered by the image ranges (as with sections-ram.ld).
+  bool
+  is_fast_separate (const char* begin, const char* end)
+  {
+    if (begin == nullptr || begin == end)
+      {
+        return false;
+      }
+
+    return !((begin >= __vectors_start && begin < get_rodata_end ())
+             || (begin >= __data_start__ && begin < __stack));
+  }
+
+  bool
+  map_fast (const char* begin, const char* end, uint64_t attributes)
+  {
+    if (!is_fast_separate (begin, end))
+      {
+        return true;
+      }
+
+    return aarch64_architecture_mmu_map (reinterpret_cast<uintptr_t> (begin),
+                                         reinterpret_cast<uintptr_t> (end),
+                                         attributes);
+  }
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+void
+aarch64_architecture_mmu_initialize (void)
+{
+  tables_used = 0;
+  allocate_table (); // Level 1.
+
+  const char* rodata_end = get_rodata_end ();
+
+  // Code, read-only data, then everything read-write up to the stack
+  // top (.data, .bss, .noinit, heap and stacks), then the fast memory
+  // sections, if separate; .fast_text is still to be copied from
+  // flash, it is writable until aarch64_architecture_mmu_protect_fast_text().
+  bool ok = aarch64_architecture_mmu_map (
+                reinterpret_cast<uintptr_t> (__vectors_start),
+                reinterpret_cast<uintptr_t> (__etext),
+                mmu::attributes<mmu::memory_type::normal,
+                                mmu::access::read_execute> ())
+            && aarch64_architecture_mmu_map (
+                reinterpret_cast<uintptr_t> (__etext),
+                reinterpret_cast<uintptr_t> (rodata_end),
+                mmu::attributes<mmu::memory_type::normal,
+                                mmu::access::read_only> ())
+            && aarch64_architecture_mmu_map (
+                reinterpret_cast<uintptr_t> (__data_start__),
+                reinterpret_cast<uintptr_t> (__stack),
+                mmu::attributes<mmu::memory_type::normal,
+                                mmu::access::read_write> ())
+            && map_fast (__fast_text_start__, __fast_text_end__,
+                         mmu::attributes<mmu::memory_type::normal,
+                                         mmu::access::read_write> ())
+            && map_fast (__fast_data_start__, __fast_data_end__,
+                         mmu::attributes<mmu::memory_type::normal,
+                                         mmu::access::read_write> ());
+  if (!ok)
+    {
+      // Increase MICRO_OS_PLUS_INTEGER_MMU_TABLES; meanwhile
+      // run with the MMU and caches off.
+      return;
+    }
+
+  aarch64_architecture_mmu_map_devices ();
+
+  aarch64_architecture_mmu_enable ();
+}
+
+bool
+aarch64_architecture_mmu_map (uintptr_t begin, uintptr_t end,
+                              uint64_t attributes)
+{
+  begin &= ~(page_size - 1);
+  end = (end + page_size - 1) & ~(page_size - 1);
+  if (end > address_space_end || tables_used == 0)
+    {
+      return false;
+    }
+
+  constexpr uintptr_t level1_size = 1ULL << level1_shift;
+  constexpr uintptr_t level2_size = 1ULL << level2_shift;
+
+  volatile uint64_t* level1 = tables[0];
+  while (begin < end)
+    {
+      volatile uint64_t* entry = &level1[table_index (begin, level1_shift)];
+      // A block would drop the existing table, with the mappings
+      // of other ranges; in this case map at the next level.
+      if ((begin & (level1_size - 1)) == 0 && end - begin >= level1_size
+          && (*entry & descriptor_type_mask) != descriptor_table)
+        {
+          *entry = begin | attributes | descriptor_block;
+          begin += level1_size;
+          continue;
+        }
+
+      volatile uint64_t* level2 = get_next_table (entry);
+      if (level2 == nullptr)
+        {
+          return false;
+        }
+
+      entry = &level2[table_index (begin, level2_shift)];
+      if ((begin & (level2_size - 1)) == 0 && end - begin >= level2_size
+          && (*entry & descriptor_type_mask) != descriptor_table)
+        {
+          *entry = begin | attributes | descriptor_block;
+          begin += level2_size;
+          continue;
+        }
+
+      volatile uint64_t* level3 = get_next_table (entry);
+      if (level3 == nullptr)
+        {
+          return false;
+        }
+
+      level3[table_index (begin, level3_shift)]
+          = begin | attributes | descriptor_page;
+      begin += page_size;
+    }
+
+  return true;
+}
+
+bool
+aarch64_architecture_mmu_protect (uintptr_t begin, uintptr_t end,
+                                  uint64_t attributes)
+{
+  begin &= ~(page_size - 1);
+  end = (end + page_size - 1) & ~(page_size - 1);
+  if (end > address_space_end || tables_used == 0)
+    {
+      return false;
+    }
+
+  while (begin < end)
+    {
+      // Walk down to the block or page descriptor.
+      unsigned int shift = level1_shift;
+      volatile uint64_t* entry = &tables[0][table_index (begin, shift)];
+      while (shift > level3_shift
+             && (*entry & descriptor_type_mask) == descriptor_table)
+        {
+          volatile uint64_t* table = reinterpret_cast<volatile uint64_t*> (
+              static_cast<uintptr_t> (*entry & descriptor_address_mask));
+          shift -= level2_shift - level3_shift;
+          entry = &table[table_index (begin, shift)];
+        }
+
+      // Blocks are not split; they must be entirely in the range.
+      uintptr_t size = 1ULL << shift;
+      if ((*entry & descriptor_valid) == 0 || (begin & (size - 1)) != 0
+          || end - begin < size)
+        {
+          return false;
+        }
+
+      // Only the permissions change, no break-before-make required.
+      *entry = begin | attributes
+               | ((shift == level3_shift) ? descriptor_page
+                                          : descriptor_block);
+      begin += size;
+    }
+
+  aarch64_architecture_tlb_invalidate_all ();
+
+  return true;
+}
+
+void
+aarch64_architecture_mmu_protect_fast_text (void)
+{
+  if (!aarch64_architecture_mmu_is_enabled ()
+      || !is_fast_separate (__fast_text_start__, __fast_text_end__))
+    {
+      return;
+    }
+
+  aarch64_architecture_mmu_protect (
+      reinterpret_cast<uintptr_t> (__fast_text_start__),
+      reinterpret_cast<uintptr_t> (__fast_text_end__),
+      mmu::attributes<mmu::memory_type::normal,
+                      mmu::access::read_execute> ());
+}
+
+void
+aarch64_architecture_mmu_enable (void)
+{
+  uint64_t mmfr0;
+
+  __asm__ volatile(
+
+      " mrs %[result], id_aa64mmfr0_el1 "
+
+      : [result] "=r"(mmfr0) /* Outputs */
+      : /* Inputs */
+      : /* Clobbers */
+  );
+
+  // Intermediate physical address size as large as implemented.
+  uint64_t tcr = tcr_t0sz | tcr_irgn0_wbwa | tcr_orgn0_wbwa | tcr_sh0_inner
+                 | tcr_tg0_4k | tcr_epd1 | ((mmfr0 & 0x7) << tcr_ips_shift);
+
+  // The tables were written with the caches off; the table walks
+  // are cacheable, so no stale lines may cover them.
+  aarch64_architecture_dcache_invalidate (tables, sizeof (tables));
+
+  __asm__ volatile(
+
+      " msr mair_el1, %[mair] \n"
+      " msr tcr_el1, %[tcr] \n"
+      " msr ttbr0_el1, %[ttbr] \n"
+      " isb \n"
+      " tlbi vmalle1 \n"
+      " ic iallu \n"
+      " dsb nsh \n"
+      " isb \n"
+
+      : /* Outputs */
+      : [mair] "r"(AARCH64_MMU_MAIR_VALUE), [tcr] "r"(tcr),
+        [ttbr] "r"(tables) /* Inputs */
+      : "memory" /* Clobbers */
+  );
+
+  uint64_t sctlr = aarch64_architecture_get_sctlr ();
+  sctlr |= AARCH64_SCTLR_M | AARCH64_SCTLR_C | AARCH64_SCTLR_I;
+  sctlr &= ~(AARCH64_SCTLR_A | AARCH64_SCTLR_WXN);
+
+  __asm__ volatile(
+
+      " msr sctlr_el1, %[sctlr] \n"
+      " isb \n"
+
+      : /* Outputs */
+      : [sctlr] "r"(sctlr) /* Inputs */
+      : "memory" /* Clobbers */
+  );
+}
+
+__attribute__ ((weak)) void
+aarch64_architecture_mmu_map_devices (void)
+{
+  aarch64_architecture_mmu_map (MICRO_OS_PLUS_INTEGER_MMU_DEVICE_BEGIN,
+                                MICRO_OS_PLUS_INTEGER_MMU_DEVICE_END,
+                                AARCH64_MMU_ATTRIBUTES_DEVICE);
+}
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(MICRO_OS_PLUS_INCLUDE_MMU)
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,125 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_INCLUDE_CONFIG_H)
+#include <micro-os-plus/config.h>
+#endif // MICRO_OS_PLUS_INCLUDE_CONFIG_H
+
+#include <micro-os-plus/architecture.h>
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+  aarch64_architecture_pmu_profile_entry_t
+      profile_table[MICRO_OS_PLUS_INTEGER_PMU_PROFILE_ENTRIES];
+
+  size_t profile_table_count;
+
+  // Shared by all sites registered after the table is full.
+  aarch64_architecture_pmu_profile_entry_t profile_overflow
+      = { "(overflow)", 0, 0, UINT64_MAX, 0 };
+
+  void
+  clear (aarch64_architecture_pmu_profile_entry_t* entry)
+  {
+    entry->count = 0;
+    entry->sum = 0;
+    entry->min = UINT64_MAX;
+    entry->max = 0;
+  }
+
+  void
+  write_line (const aarch64_architecture_pmu_profile_entry_t* entry)
+  {
+    char line[160];
+
+    uint64_t average = entry->count ? (entry->sum / entry->count) : 0;
+    uint64_t min = entry->count ? entry->min : 0;
+
+    snprintf (line, sizeof (line),
+              "%s,%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64
+              "\n",
+              entry->name, entry->count, min, average, entry->max,
+              entry->sum);
+
+    micro_os_plus_semihosting_call_host (
+        AARCH64_SEMIHOSTING_SYS_WRITE0,
+        reinterpret_cast<micro_os_plus_semihosting_param_block_t*> (line));
+  }
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+aarch64_architecture_pmu_profile_entry_t*
+aarch64_architecture_pmu_profile_register (const char* name)
+{
+  for (size_t i = 0; i < profile_table_count; ++i)
+    {
+      if (profile_table[i].name == name
+          || std::strcmp (profile_table[i].name, name) == 0)
+        {
+          return &profile_table[i];
+        }
+    }
+
+  if (profile_table_count >= MICRO_OS_PLUS_INTEGER_PMU_PROFILE_ENTRIES)
+    {
+      return &profile_overflow;
+    }
+
+  aarch64_architecture_pmu_profile_entry_t* entry
+      = &profile_table[profile_table_count++];
+  entry->name = name;
+  clear (entry);
+
+  return entry;
+}
+
+void
+aarch64_architecture_pmu_profile_reset (void)
+{
+  for (size_t i = 0; i < profile_table_count; ++i)
+    {
+      clear (&profile_table[i]);
+    }
+  clear (&profile_overflow);
+}
+
+void
+aarch64_architecture_pmu_profile_dump (void)
+{
+  static const char header[] = "name,count,min,average,max,sum\n";
+
+  micro_os_plus_semihosting_call_host (
+      AARCH64_SEMIHOSTING_SYS_WRITE0,
+      reinterpret_cast<micro_os_plus_semihosting_param_block_t*> (
+          const_cast<char*> (header)));
+
+  for (size_t i = 0; i < profile_table_count; ++i)
+    {
+      write_line (&profile_table[i]);
+    }
+
+  if (profile_overflow.count != 0)
+    {
+      write_line (&profile_overflow);
+    }
+}
+
+// ----------------------------------------------------------------------------
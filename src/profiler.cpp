@@ -0,0 +1,319 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_INCLUDE_CONFIG_H)
+#include <micro-os-plus/config.h>
+#endif // MICRO_OS_PLUS_INCLUDE_CONFIG_H
+
+#include <micro-os-plus/architecture.h>
+
+#if defined(MICRO_OS_PLUS_INCLUDE_PROFILER)
+
+#include <cstdlib>
+#include <cstring>
+
+// ----------------------------------------------------------------------------
+
+extern "C"
+{
+  // Defined by the linker script.
+  extern char __vectors_start[];
+  extern char __etext[];
+  extern char __stack[];
+}
+
+namespace
+{
+  static_assert ((MICRO_OS_PLUS_INTEGER_PROFILER_ARCS
+                  & (MICRO_OS_PLUS_INTEGER_PROFILER_ARCS - 1))
+                     == 0,
+                 "MICRO_OS_PLUS_INTEGER_PROFILER_ARCS must be a power of 2");
+
+  // As in glibc `gmon_out.h`.
+  constexpr uint8_t gmon_tag_time_hist = 0;
+  constexpr uint8_t gmon_tag_cg_arc = 1;
+  constexpr uint32_t gmon_version = 1;
+
+  uint16_t histogram[MICRO_OS_PLUS_INTEGER_PROFILER_BINS];
+
+  uintptr_t low_pc;
+  uintptr_t high_pc;
+  uint32_t bin_shift;
+
+  uint32_t rate;
+  uint64_t period;
+
+  volatile uint64_t samples_count;
+  volatile uint64_t dropped_count;
+
+#if MICRO_OS_PLUS_INTEGER_PROFILER_ARCS > 0
+
+  struct arc_s
+  {
+    uintptr_t from_pc;
+    uintptr_t self_pc;
+    uint32_t count;
+  };
+
+  arc_s arcs[MICRO_OS_PLUS_INTEGER_PROFILER_ARCS];
+
+  // Samples may come from all cores.
+  aarch64_architecture_ticket_lock_t arcs_lock;
+
+  // Linear probing, a few slots only; an interrupt handler must not
+  // search the entire table.
+  constexpr size_t arcs_probes = 8;
+
+  void
+  count_arc (uintptr_t from_pc, uintptr_t self_pc)
+  {
+    size_t index = ((from_pc >> 2) ^ (self_pc >> 2) * 0x9E3779B1U)
+                   & (MICRO_OS_PLUS_INTEGER_PROFILER_ARCS - 1);
+
+    aarch64_architecture_ticket_lock_acquire (&arcs_lock);
+    for (size_t i = 0; i < arcs_probes; ++i)
+      {
+        arc_s* arc = &arcs[(index + i)
+                           & (MICRO_OS_PLUS_INTEGER_PROFILER_ARCS - 1)];
+        if (arc->count == 0)
+          {
+            arc->from_pc = from_pc;
+            arc->self_pc = self_pc;
+            arc->count = 1;
+            aarch64_architecture_ticket_lock_release (&arcs_lock);
+            return;
+          }
+        if (arc->from_pc == from_pc && arc->self_pc == self_pc)
+          {
+            ++arc->count;
+            aarch64_architecture_ticket_lock_release (&arcs_lock);
+            return;
+          }
+      }
+    aarch64_architecture_ticket_lock_release (&arcs_lock);
+
+    aarch64_architecture_atomic_fetch_add_64 (&dropped_count, 1);
+  }
+
+  void
+  backtrace (uintptr_t self_pc, uintptr_t fp)
+  {
+    // The AAPCS64 frame records are {previous fp, lr} pairs, linked
+    // towards higher addresses; stop at anything that does not look
+    // like one, the interrupted code may not maintain x29.
+    uintptr_t previous = reinterpret_cast<uintptr_t> (__etext);
+    for (uint32_t depth = 0;
+         depth < MICRO_OS_PLUS_INTEGER_PROFILER_BACKTRACE_DEPTH; ++depth)
+      {
+        if (fp <= previous || fp >= reinterpret_cast<uintptr_t> (__stack)
+            || (fp & 7) != 0)
+          {
+            break;
+          }
+
+        const uintptr_t* record = reinterpret_cast<const uintptr_t*> (fp);
+        uintptr_t from_pc = record[1];
+        if (from_pc < low_pc
+            || from_pc >= reinterpret_cast<uintptr_t> (__etext))
+          {
+            break;
+          }
+
+        count_arc (from_pc, self_pc);
+
+        self_pc = from_pc;
+        previous = fp;
+        fp = record[0];
+      }
+  }
+
+#endif // MICRO_OS_PLUS_INTEGER_PROFILER_ARCS > 0
+
+  void
+  write_at_exit (void)
+  {
+    aarch64_architecture_profiler_stop ();
+    aarch64_architecture_profiler_write ("gmon.out");
+  }
+
+  using stream_t = aarch64::architecture::semihosting::stream<>;
+
+  bool
+  put_bytes (stream_t& stream, const void* data, size_t size)
+  {
+    return stream.write (data, size) == static_cast<ptrdiff_t> (size);
+  }
+
+  template <typename T>
+  bool
+  put (stream_t& stream, T value)
+  {
+    return put_bytes (stream, &value, sizeof (value));
+  }
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+void
+aarch64_architecture_profiler_start (uint32_t frequency)
+{
+  aarch64_architecture_generic_timer_disable ();
+
+  // The smallest power of 2 bin that covers the entire code.
+  low_pc = reinterpret_cast<uintptr_t> (__vectors_start);
+  size_t text_size = reinterpret_cast<uintptr_t> (__etext) - low_pc;
+  bin_shift = 2;
+  while ((static_cast<size_t> (MICRO_OS_PLUS_INTEGER_PROFILER_BINS)
+          << bin_shift)
+         < text_size)
+    {
+      ++bin_shift;
+    }
+  high_pc = low_pc
+            + (static_cast<uintptr_t> (MICRO_OS_PLUS_INTEGER_PROFILER_BINS)
+               << bin_shift);
+
+  std::memset (histogram, 0, sizeof (histogram));
+#if MICRO_OS_PLUS_INTEGER_PROFILER_ARCS > 0
+  std::memset (arcs, 0, sizeof (arcs));
+#endif // MICRO_OS_PLUS_INTEGER_PROFILER_ARCS > 0
+  samples_count = 0;
+  dropped_count = 0;
+
+  static bool registered;
+  if (!registered)
+    {
+      registered = true;
+      std::atexit (write_at_exit);
+    }
+
+  rate = frequency;
+  period = aarch64_architecture_generic_timer_get_frequency () / frequency;
+  aarch64_architecture_generic_timer_set_compare (
+      aarch64_architecture_generic_timer_get_counter () + period);
+  aarch64_architecture_generic_timer_enable ();
+}
+
+void
+aarch64_architecture_profiler_stop (void)
+{
+  aarch64_architecture_generic_timer_disable ();
+}
+
+void
+aarch64_architecture_profiler_sample (uintptr_t pc, uintptr_t fp)
+{
+  aarch64_architecture_atomic_fetch_add_64 (&samples_count, 1);
+
+  if (pc < low_pc || pc >= high_pc)
+    {
+      aarch64_architecture_atomic_fetch_add_64 (&dropped_count, 1);
+      return;
+    }
+
+  uint16_t* bin = &histogram[(pc - low_pc) >> bin_shift];
+  if (*bin != UINT16_MAX)
+    {
+      ++*bin;
+    }
+
+#if MICRO_OS_PLUS_INTEGER_PROFILER_ARCS > 0
+  backtrace (pc, fp);
+#else
+  (void)fp;
+#endif // MICRO_OS_PLUS_INTEGER_PROFILER_ARCS > 0
+}
+
+void
+aarch64_architecture_profiler_interrupt_handler (
+    aarch64_architecture_exception_frame_t* frame)
+{
+  // Keep the period exact; if late (for example after a breakpoint),
+  // restart from now instead of catching up.
+  uint64_t next = aarch64_architecture_generic_timer_get_compare () + period;
+  uint64_t now = aarch64_architecture_generic_timer_get_counter ();
+  if (next <= now)
+    {
+      next = now + period;
+    }
+  aarch64_architecture_generic_timer_set_compare (next);
+
+  aarch64_architecture_profiler_sample (frame->elr, frame->fp);
+}
+
+int
+aarch64_architecture_profiler_write (const char* path)
+{
+  stream_t stream{ path, AARCH64_SEMIHOSTING_OPEN_WRITE_BINARY };
+  if (!stream.is_open ())
+    {
+      return -1;
+    }
+
+  // The file header.
+  static const char cookie[4] = { 'g', 'm', 'o', 'n' };
+  static const char spare[12] = {};
+  bool ok = put_bytes (stream, cookie, sizeof (cookie));
+  ok = ok && put (stream, gmon_version);
+  ok = ok && put_bytes (stream, spare, sizeof (spare));
+
+  // The histogram record.
+  static const char dimension[15] = "seconds";
+  ok = ok && put (stream, gmon_tag_time_hist);
+  ok = ok && put (stream, low_pc);
+  ok = ok && put (stream, high_pc);
+  ok = ok
+       && put (stream,
+               static_cast<uint32_t> (MICRO_OS_PLUS_INTEGER_PROFILER_BINS));
+  ok = ok && put (stream, rate);
+  ok = ok && put_bytes (stream, dimension, sizeof (dimension));
+  ok = ok && put (stream, 's');
+  ok = ok && put_bytes (stream, histogram, sizeof (histogram));
+
+#if MICRO_OS_PLUS_INTEGER_PROFILER_ARCS > 0
+  // The call graph records.
+  for (size_t i = 0; ok && i < MICRO_OS_PLUS_INTEGER_PROFILER_ARCS; ++i)
+    {
+      if (arcs[i].count != 0)
+        {
+          ok = put (stream, gmon_tag_cg_arc);
+          ok = ok && put (stream, arcs[i].from_pc);
+          ok = ok && put (stream, arcs[i].self_pc);
+          ok = ok && put (stream, arcs[i].count);
+        }
+    }
+#endif // MICRO_OS_PLUS_INTEGER_PROFILER_ARCS > 0
+
+  ok = stream.close () && ok;
+
+  return ok ? 0 : -1;
+}
+
+uint64_t
+aarch64_architecture_profiler_get_samples_count (void)
+{
+  return samples_count;
+}
+
+uint64_t
+aarch64_architecture_profiler_get_dropped_count (void)
+{
+  return dropped_count;
+}
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(MICRO_OS_PLUS_INCLUDE_PROFILER)
+
+// ----------------------------------------------------------------------------
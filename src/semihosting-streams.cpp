@@ -0,0 +1,341 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_INCLUDE_CONFIG_H)
+#include <micro-os-plus/config.h>
+#endif // MICRO_OS_PLUS_INCLUDE_CONFIG_H
+
+#include <micro-os-plus/architecture.h>
+
+#include <cstring>
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+  using param_t = micro_os_plus_semihosting_param_block_t;
+
+  // SYS_WRITE and SYS_READ return the number of bytes NOT transferred.
+  micro_os_plus_semihosting_response_t
+  host_write (micro_os_plus_semihosting_response_t handle,
+              const uint8_t* data, size_t count)
+  {
+    param_t block[3] = { static_cast<param_t> (handle),
+                         reinterpret_cast<param_t> (data), count };
+    return micro_os_plus_semihosting_call_host (
+        AARCH64_SEMIHOSTING_SYS_WRITE, block);
+  }
+
+  micro_os_plus_semihosting_response_t
+  host_read (micro_os_plus_semihosting_response_t handle, uint8_t* data,
+             size_t count)
+  {
+    param_t block[3] = { static_cast<param_t> (handle),
+                         reinterpret_cast<param_t> (data), count };
+    return micro_os_plus_semihosting_call_host (AARCH64_SEMIHOSTING_SYS_READ,
+                                                block);
+  }
+
+  int
+  fail (aarch64_architecture_semihosting_stream_t* stream)
+  {
+    stream->flags |= AARCH64_SEMIHOSTING_STREAM_ERROR;
+    return -1;
+  }
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+int
+aarch64_architecture_semihosting_stream_open (
+    aarch64_architecture_semihosting_stream_t* stream, const char* path,
+    uint32_t mode, void* buffer, size_t size)
+{
+  stream->handle = -1;
+  stream->buffer = static_cast<uint8_t*> (buffer);
+  stream->size = size;
+  stream->head = 0;
+  stream->tail = 0;
+  stream->flags = 0;
+
+  if (size == 0 || (size & (size - 1)) != 0)
+    {
+      return fail (stream);
+    }
+
+  param_t block[3] = { reinterpret_cast<param_t> (path), mode,
+                       std::strlen (path) };
+  stream->handle
+      = micro_os_plus_semihosting_call_host (AARCH64_SEMIHOSTING_SYS_OPEN,
+                                             block);
+  if (stream->handle == -1)
+    {
+      return fail (stream);
+    }
+
+  if (mode >= AARCH64_SEMIHOSTING_OPEN_WRITE)
+    {
+      stream->flags |= AARCH64_SEMIHOSTING_STREAM_OUTPUT;
+      if (std::strcmp (path, AARCH64_SEMIHOSTING_CONSOLE_PATH) == 0)
+        {
+          stream->flags |= AARCH64_SEMIHOSTING_STREAM_LINE_BUFFERED;
+        }
+    }
+
+  return 0;
+}
+
+int
+aarch64_architecture_semihosting_stream_flush (
+    aarch64_architecture_semihosting_stream_t* stream)
+{
+  if (!(stream->flags & AARCH64_SEMIHOSTING_STREAM_OUTPUT))
+    {
+      return 0;
+    }
+
+  // At most two calls, the content may wrap around the buffer end.
+  while (stream->head != stream->tail)
+    {
+      size_t offset = stream->tail & (stream->size - 1);
+      size_t count = stream->head - stream->tail;
+      if (count > stream->size - offset)
+        {
+          count = stream->size - offset;
+        }
+
+      if (host_write (stream->handle, stream->buffer + offset, count) != 0)
+        {
+          // Drop the content, retrying would duplicate partial writes.
+          stream->tail = stream->head;
+          return fail (stream);
+        }
+      stream->tail += count;
+    }
+
+  // Keep the indices small and the next flush in a single call.
+  stream->head = 0;
+  stream->tail = 0;
+
+  return 0;
+}
+
+ptrdiff_t
+aarch64_architecture_semihosting_stream_write (
+    aarch64_architecture_semihosting_stream_t* stream, const void* data,
+    size_t count)
+{
+  if (!(stream->flags & AARCH64_SEMIHOSTING_STREAM_OUTPUT))
+    {
+      return fail (stream);
+    }
+
+  const uint8_t* p = static_cast<const uint8_t*> (data);
+  size_t remaining = count;
+
+  while (remaining != 0)
+    {
+      size_t free_bytes = stream->size - (stream->head - stream->tail);
+      if (free_bytes == 0)
+        {
+          if (aarch64_architecture_semihosting_stream_flush (stream) != 0)
+            {
+              return -1;
+            }
+          free_bytes = stream->size;
+        }
+
+      // Large writes to an empty buffer go directly to the host.
+      if (remaining >= stream->size && stream->head == stream->tail)
+        {
+          if (host_write (stream->handle, p, remaining) != 0)
+            {
+              return fail (stream);
+            }
+          return static_cast<ptrdiff_t> (count);
+        }
+
+      size_t offset = stream->head & (stream->size - 1);
+      size_t chunk = remaining;
+      if (chunk > free_bytes)
+        {
+          chunk = free_bytes;
+        }
+      if (chunk > stream->size - offset)
+        {
+          chunk = stream->size - offset;
+        }
+
+      std::memcpy (stream->buffer + offset, p, chunk);
+      stream->head += chunk;
+      p += chunk;
+      remaining -= chunk;
+    }
+
+  if ((stream->flags & AARCH64_SEMIHOSTING_STREAM_LINE_BUFFERED)
+      && std::memchr (data, '\n', count) != nullptr)
+    {
+      if (aarch64_architecture_semihosting_stream_flush (stream) != 0)
+        {
+          return -1;
+        }
+    }
+
+  return static_cast<ptrdiff_t> (count);
+}
+
+ptrdiff_t
+aarch64_architecture_semihosting_stream_puts (
+    aarch64_architecture_semihosting_stream_t* stream, const char* str)
+{
+  return aarch64_architecture_semihosting_stream_write (stream, str,
+                                                        std::strlen (str));
+}
+
+ptrdiff_t
+aarch64_architecture_semihosting_stream_read (
+    aarch64_architecture_semihosting_stream_t* stream, void* data,
+    size_t count)
+{
+  if (stream->flags & AARCH64_SEMIHOSTING_STREAM_OUTPUT)
+    {
+      return fail (stream);
+    }
+
+  uint8_t* p = static_cast<uint8_t*> (data);
+  size_t remaining = count;
+  bool more = true;
+
+  while (remaining != 0)
+    {
+      size_t available = stream->head - stream->tail;
+      if (available != 0)
+        {
+          // After a refill the content never wraps.
+          size_t offset = stream->tail & (stream->size - 1);
+          size_t chunk = (remaining < available) ? remaining : available;
+
+          std::memcpy (p, stream->buffer + offset, chunk);
+          stream->tail += chunk;
+          p += chunk;
+          remaining -= chunk;
+          continue;
+        }
+
+      if (!more || (stream->flags & AARCH64_SEMIHOSTING_STREAM_EOF))
+        {
+          break;
+        }
+
+      size_t requested;
+      micro_os_plus_semihosting_response_t not_read;
+      if (remaining >= stream->size)
+        {
+          // Large reads go directly to the destination.
+          requested = remaining;
+          not_read = host_read (stream->handle, p, requested);
+          if (not_read < 0 || static_cast<size_t> (not_read) > requested)
+            {
+              return fail (stream);
+            }
+          size_t done = requested - static_cast<size_t> (not_read);
+          p += done;
+          remaining -= done;
+        }
+      else
+        {
+          // Read ahead an entire buffer.
+          requested = stream->size;
+          not_read = host_read (stream->handle, stream->buffer, requested);
+          if (not_read < 0 || static_cast<size_t> (not_read) > requested)
+            {
+              return fail (stream);
+            }
+          stream->tail = 0;
+          stream->head = requested - static_cast<size_t> (not_read);
+        }
+
+      if (static_cast<size_t> (not_read) == requested)
+        {
+          stream->flags |= AARCH64_SEMIHOSTING_STREAM_EOF;
+          break;
+        }
+
+      // After a short read (end of file, or a console line) return
+      // what is available, without waiting for more.
+      more = (not_read == 0);
+    }
+
+  return static_cast<ptrdiff_t> (count - remaining);
+}
+
+int
+aarch64_architecture_semihosting_stream_seek (
+    aarch64_architecture_semihosting_stream_t* stream, size_t position)
+{
+  if (aarch64_architecture_semihosting_stream_flush (stream) != 0)
+    {
+      return -1;
+    }
+
+  // Discard the read-ahead content.
+  stream->head = 0;
+  stream->tail = 0;
+  stream->flags &= ~AARCH64_SEMIHOSTING_STREAM_EOF;
+
+  param_t block[2] = { static_cast<param_t> (stream->handle), position };
+  if (micro_os_plus_semihosting_call_host (AARCH64_SEMIHOSTING_SYS_SEEK,
+                                           block)
+      != 0)
+    {
+      return fail (stream);
+    }
+
+  return 0;
+}
+
+ptrdiff_t
+aarch64_architecture_semihosting_stream_length (
+    aarch64_architecture_semihosting_stream_t* stream)
+{
+  param_t block[1] = { static_cast<param_t> (stream->handle) };
+  return micro_os_plus_semihosting_call_host (AARCH64_SEMIHOSTING_SYS_FLEN,
+                                              block);
+}
+
+int
+aarch64_architecture_semihosting_stream_close (
+    aarch64_architecture_semihosting_stream_t* stream)
+{
+  if (stream->handle == -1)
+    {
+      return 0;
+    }
+
+  int result = aarch64_architecture_semihosting_stream_flush (stream);
+
+  param_t block[1] = { static_cast<param_t> (stream->handle) };
+  if (micro_os_plus_semihosting_call_host (AARCH64_SEMIHOSTING_SYS_CLOSE,
+                                           block)
+      != 0)
+    {
+      result = -1;
+    }
+  stream->handle = -1;
+  stream->flags = 0;
+
+  return result;
+}
+
+// ----------------------------------------------------------------------------
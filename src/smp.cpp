@@ -0,0 +1,157 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_INCLUDE_CONFIG_H)
+#include <micro-os-plus/config.h>
+#endif // MICRO_OS_PLUS_INCLUDE_CONFIG_H
+
+#include <micro-os-plus/architecture.h>
+
+#include <cstddef>
+
+#if defined(MICRO_OS_PLUS_INCLUDE_SMP)
+
+// ----------------------------------------------------------------------------
+
+extern "C"
+{
+  // Defined by the linker script; absolute symbols, use the address.
+  extern char __cores_count[] __attribute__ ((weak));
+
+  // In smp-start.S.
+  void
+  aarch64_architecture_smp_secondary_reset (void);
+}
+
+namespace
+{
+  // Read by the secondary cores with the caches off; keep each entry
+  // in its own cache line, so it can be cleaned without side effects.
+  struct alignas (64) smp_entry_s
+  {
+    aarch64_architecture_smp_entry_t entry;
+    void* arg;
+    uint64_t core;
+    // The translation registers of the starting core; sctlr is 0
+    // if its MMU is off.
+    uint64_t mair;
+    uint64_t tcr;
+    uint64_t ttbr0;
+    uint64_t sctlr;
+  };
+
+  smp_entry_s smp_entries[MICRO_OS_PLUS_INTEGER_SMP_MAX_CORES];
+} // namespace
+
+// Aff0 is 8 bits; smp-start.S compares the core number with
+// MAX_CORES as an immediate.
+static_assert (MICRO_OS_PLUS_INTEGER_SMP_CORES_PER_CLUSTER >= 1
+                   && MICRO_OS_PLUS_INTEGER_SMP_CORES_PER_CLUSTER <= 256,
+               "MICRO_OS_PLUS_INTEGER_SMP_CORES_PER_CLUSTER must be 1-256");
+static_assert (MICRO_OS_PLUS_INTEGER_SMP_MAX_CORES >= 1
+                   && MICRO_OS_PLUS_INTEGER_SMP_MAX_CORES <= 4095,
+               "MICRO_OS_PLUS_INTEGER_SMP_MAX_CORES must be 1-4095");
+
+static_assert (offsetof (smp_entry_s, core) == AARCH64_SMP_ENTRY_CORE,
+               "Adjust AARCH64_SMP_ENTRY_CORE");
+static_assert (offsetof (smp_entry_s, mair) == AARCH64_SMP_ENTRY_MAIR,
+               "Adjust AARCH64_SMP_ENTRY_MAIR");
+static_assert (offsetof (smp_entry_s, tcr) == AARCH64_SMP_ENTRY_TCR,
+               "Adjust AARCH64_SMP_ENTRY_TCR");
+static_assert (offsetof (smp_entry_s, ttbr0) == AARCH64_SMP_ENTRY_TTBR0,
+               "Adjust AARCH64_SMP_ENTRY_TTBR0");
+static_assert (offsetof (smp_entry_s, sctlr) == AARCH64_SMP_ENTRY_SCTLR,
+               "Adjust AARCH64_SMP_ENTRY_SCTLR");
+
+// ----------------------------------------------------------------------------
+
+uint32_t
+aarch64_architecture_get_cores_count (void)
+{
+  if (__cores_count == nullptr)
+    {
+      return 1; // Not a multi-core linker script.
+    }
+
+  uint32_t count = static_cast<uint32_t> (
+      reinterpret_cast<uintptr_t> (__cores_count));
+  return (count < MICRO_OS_PLUS_INTEGER_SMP_MAX_CORES)
+             ? count
+             : MICRO_OS_PLUS_INTEGER_SMP_MAX_CORES;
+}
+
+int32_t
+aarch64_architecture_smp_start_core (uint32_t core,
+                                     aarch64_architecture_smp_entry_t entry,
+                                     void* arg)
+{
+  if (core >= aarch64_architecture_get_cores_count () || entry == nullptr)
+    {
+      return AARCH64_PSCI_INVALID_PARAMETERS;
+    }
+
+  smp_entry_s* p = &smp_entries[core];
+  p->entry = entry;
+  p->arg = arg;
+  p->core = core;
+
+  p->sctlr = 0;
+#if defined(MICRO_OS_PLUS_INCLUDE_MMU)
+  if (aarch64_architecture_mmu_is_enabled ())
+    {
+      using namespace aarch64::architecture::registers;
+
+      p->mair = sysreg<"MAIR_EL1">::read ();
+      p->tcr = sysreg<"TCR_EL1">::read ();
+      p->ttbr0 = sysreg<"TTBR0_EL1">::read ();
+      p->sctlr = aarch64_architecture_get_sctlr ();
+    }
+#endif // defined(MICRO_OS_PLUS_INCLUDE_MMU)
+
+  // The new core starts with the caches off; push the entry to memory.
+  aarch64_architecture_dcache_clean (p, sizeof (*p));
+
+  return static_cast<int32_t> (aarch64_architecture_psci_call (
+      AARCH64_PSCI_CPU_ON, aarch64_architecture_get_core_affinity (core),
+      reinterpret_cast<uintptr_t> (&aarch64_architecture_smp_secondary_reset),
+      reinterpret_cast<uintptr_t> (p)));
+}
+
+void
+aarch64_architecture_smp_stop_core (void)
+{
+  aarch64_architecture_psci_call (AARCH64_PSCI_CPU_OFF, 0, 0, 0);
+
+  // Not expected to return; park the core if it does.
+  while (true)
+    {
+      aarch64_architecture_wfi ();
+    }
+}
+
+void
+aarch64_architecture_smp_secondary_main (uint32_t core)
+{
+  const volatile smp_entry_s* p = &smp_entries[core];
+
+  p->entry (p->arg);
+
+  aarch64_architecture_smp_stop_core ();
+}
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(MICRO_OS_PLUS_INCLUDE_SMP)
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,122 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_INCLUDE_CONFIG_H)
+#include <micro-os-plus/config.h>
+#endif // MICRO_OS_PLUS_INCLUDE_CONFIG_H
+
+#include <micro-os-plus/architecture.h>
+
+#if defined(MICRO_OS_PLUS_HAS_INTERRUPTS_STACK)
+
+// ----------------------------------------------------------------------------
+
+extern "C"
+{
+  // Defined by the linker script; absolute symbols, use the address.
+  extern char __interrupts_stack[] __attribute__ ((weak));
+  extern char __interrupts_stack_size[] __attribute__ ((weak));
+  extern char __cores_count[] __attribute__ ((weak));
+}
+
+namespace
+{
+  size_t
+  interrupts_stack_size (uint32_t core)
+  {
+    uint32_t cores = (__cores_count == nullptr)
+                         ? 1
+                         : static_cast<uint32_t> (
+                             reinterpret_cast<uintptr_t> (__cores_count));
+    if (__interrupts_stack == nullptr || core >= cores)
+      {
+        return 0;
+      }
+
+    return reinterpret_cast<uintptr_t> (__interrupts_stack_size);
+  }
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+void*
+aarch64_architecture_interrupts_stack_get_end (uint32_t core)
+{
+  size_t size = interrupts_stack_size (core);
+  if (size == 0)
+    {
+      return nullptr;
+    }
+
+  // Core 0 at the top.
+  return __interrupts_stack - core * size;
+}
+
+void*
+aarch64_architecture_interrupts_stack_get_begin (uint32_t core)
+{
+  size_t size = interrupts_stack_size (core);
+  if (size == 0)
+    {
+      return nullptr;
+    }
+
+  return __interrupts_stack - (core + 1) * size;
+}
+
+bool
+aarch64_architecture_interrupts_stack_install (void)
+{
+  uint32_t core = aarch64_architecture_get_core_id ();
+  void* begin = aarch64_architecture_interrupts_stack_get_begin (core);
+  void* end = aarch64_architecture_interrupts_stack_get_end (core);
+  if (begin == nullptr)
+    {
+      return false;
+    }
+
+  aarch64_architecture_register_t daif
+      = aarch64_architecture_interrupts_save_and_disable ();
+
+  // Already on SP_EL0, possibly installed before.
+  bool ok = (aarch64_architecture_get_spsel () != 0);
+  if (ok)
+    {
+      aarch64_architecture_stack_fill (begin, end);
+      aarch64_architecture_interrupts_stack_switch (end);
+    }
+
+  aarch64_architecture_interrupts_restore (daif);
+
+  return ok;
+}
+
+size_t
+aarch64_architecture_interrupts_stack_get_high_water (uint32_t core)
+{
+  void* begin = aarch64_architecture_interrupts_stack_get_begin (core);
+  if (begin == nullptr)
+    {
+      return 0;
+    }
+
+  return aarch64_architecture_stack_get_high_water (
+      begin, aarch64_architecture_interrupts_stack_get_end (core));
+}
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(MICRO_OS_PLUS_HAS_INTERRUPTS_STACK)
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,75 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_INCLUDE_CONFIG_H)
+#include <micro-os-plus/config.h>
+#endif // MICRO_OS_PLUS_INCLUDE_CONFIG_H
+
+#include <micro-os-plus/architecture.h>
+
+#if defined(MICRO_OS_PLUS_INCLUDE_STARTUP_INIT_MEMORY)
+
+// ----------------------------------------------------------------------------
+
+extern "C"
+{
+  // Defined by the linker script; arrays of 32-bit addresses, three
+  // per data region (from, begin, end) and two per bss region.
+  extern uint32_t __data_regions_array_begin__[];
+  extern uint32_t __data_regions_array_end__[];
+  extern uint32_t __bss_regions_array_begin__[];
+  extern uint32_t __bss_regions_array_end__[];
+}
+
+// ----------------------------------------------------------------------------
+
+void
+aarch64_architecture_startup_initialize_memory (void)
+{
+  for (const uint32_t* p = __data_regions_array_begin__;
+       p < __data_regions_array_end__; p += 3)
+    {
+      aarch64_architecture_startup_copy_data (
+          reinterpret_cast<const uint32_t*> (static_cast<uintptr_t> (p[0])),
+          reinterpret_cast<uint32_t*> (static_cast<uintptr_t> (p[1])),
+          reinterpret_cast<uint32_t*> (static_cast<uintptr_t> (p[2])));
+
+      // The region may be code (.fast_text), copied from flash.
+      if (p[0] != p[1])
+        {
+          aarch64_architecture_icache_sync (
+              reinterpret_cast<const void*> (static_cast<uintptr_t> (p[1])),
+              p[2] - p[1]);
+        }
+    }
+
+  for (const uint32_t* p = __bss_regions_array_begin__;
+       p < __bss_regions_array_end__; p += 2)
+    {
+      aarch64_architecture_startup_clear_bss (
+          reinterpret_cast<uint32_t*> (static_cast<uintptr_t> (p[0])),
+          reinterpret_cast<uint32_t*> (static_cast<uintptr_t> (p[1])));
+    }
+
+#if defined(MICRO_OS_PLUS_INCLUDE_MMU)
+  // Copied, so no longer writable.
+  aarch64_architecture_mmu_protect_fast_text ();
+#endif // defined(MICRO_OS_PLUS_INCLUDE_MMU)
+}
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(MICRO_OS_PLUS_INCLUDE_STARTUP_INIT_MEMORY)
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,43 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_INCLUDE_CONFIG_H)
+#include <micro-os-plus/config.h>
+#endif // MICRO_OS_PLUS_INCLUDE_CONFIG_H
+
+#include <micro-os-plus/architecture.h>
+
+#if defined(MICRO_OS_PLUS_INCLUDE_SYSCALLS)
+
+// ----------------------------------------------------------------------------
+
+// The gate compares the number with an immediate.
+static_assert (MICRO_OS_PLUS_INTEGER_SYSCALLS_COUNT > 0
+                   && MICRO_OS_PLUS_INTEGER_SYSCALLS_COUNT <= 4096,
+               "MICRO_OS_PLUS_INTEGER_SYSCALLS_COUNT must be 1-4096");
+static_assert (sizeof (aarch64_architecture_syscalls_table_t)
+                   == MICRO_OS_PLUS_INTEGER_SYSCALLS_COUNT * 8,
+               "The gate expects 8 bytes per handler");
+
+// ----------------------------------------------------------------------------
+// Default table, to be redefined by the kernel.
+
+extern "C" __attribute__ ((weak)) const aarch64_architecture_syscalls_table_t
+    aarch64_architecture_syscalls_table{};
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(MICRO_OS_PLUS_INCLUDE_SYSCALLS)
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,227 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_INCLUDE_CONFIG_H)
+#include <micro-os-plus/config.h>
+#endif // MICRO_OS_PLUS_INCLUDE_CONFIG_H
+
+#include <micro-os-plus/architecture.h>
+
+#if defined(MICRO_OS_PLUS_INCLUDE_TRACE)
+
+// ----------------------------------------------------------------------------
+
+static_assert ((MICRO_OS_PLUS_INTEGER_TRACE_RECORDS
+                & (MICRO_OS_PLUS_INTEGER_TRACE_RECORDS - 1))
+                   == 0,
+               "MICRO_OS_PLUS_INTEGER_TRACE_RECORDS must be a power of 2");
+static_assert (sizeof (aarch64_architecture_trace_record_t) == 32);
+static_assert (sizeof (aarch64_architecture_trace_file_t) == 48);
+static_assert (sizeof (aarch64_architecture_trace_file_ring_t) == 16);
+
+// Not cleared by the startup, to survive a warm reset.
+__attribute__ ((section (".noinit")))
+aarch64_architecture_trace_buffer_t aarch64_architecture_trace_buffer;
+
+volatile uint32_t aarch64_architecture_trace_enabled;
+
+namespace
+{
+  bool recovered;
+
+  using stream_t = aarch64::architecture::semihosting::stream<>;
+
+  bool
+  is_valid (const aarch64_architecture_trace_buffer_t* buffer)
+  {
+    return buffer->magic == AARCH64_TRACE_MAGIC
+           && buffer->check == ~buffer->sequence
+           && buffer->cores == MICRO_OS_PLUS_INTEGER_SMP_MAX_CORES
+           && buffer->records == MICRO_OS_PLUS_INTEGER_TRACE_RECORDS;
+  }
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+bool
+aarch64_architecture_trace_initialize (void)
+{
+  aarch64_architecture_trace_enabled = 0;
+
+  if (is_valid (&aarch64_architecture_trace_buffer))
+    {
+      recovered = true;
+      return true;
+    }
+
+  // Garbage after a power-on reset.
+  aarch64_architecture_trace_buffer.sequence = 0;
+  aarch64_architecture_trace_start ();
+
+  return false;
+}
+
+void
+aarch64_architecture_trace_start (void)
+{
+  aarch64_architecture_trace_stop ();
+
+  aarch64_architecture_trace_buffer_t* buffer
+      = &aarch64_architecture_trace_buffer;
+  for (uint32_t core = 0; core < MICRO_OS_PLUS_INTEGER_SMP_MAX_CORES; ++core)
+    {
+      buffer->rings[core].total = 0;
+    }
+
+  buffer->magic = AARCH64_TRACE_MAGIC;
+  buffer->sequence = buffer->sequence + 1;
+  buffer->check = ~buffer->sequence;
+  buffer->cores = MICRO_OS_PLUS_INTEGER_SMP_MAX_CORES;
+  buffer->records = MICRO_OS_PLUS_INTEGER_TRACE_RECORDS;
+  recovered = false;
+
+  // The other cores see the cleared rings before the first record.
+  aarch64_architecture_store_release_32 (&aarch64_architecture_trace_enabled,
+                                         1);
+}
+
+void
+aarch64_architecture_trace_stop (void)
+{
+  aarch64_architecture_trace_enabled = 0;
+  aarch64_architecture_dmb_ish ();
+}
+
+void
+aarch64_architecture_trace_flush (void)
+{
+  aarch64_architecture_dcache_clean (
+      &aarch64_architecture_trace_buffer,
+      sizeof (aarch64_architecture_trace_buffer));
+}
+
+bool
+aarch64_architecture_trace_is_recovered (void)
+{
+  return recovered;
+}
+
+uint64_t
+aarch64_architecture_trace_get_sequence (void)
+{
+  return aarch64_architecture_trace_buffer.sequence;
+}
+
+size_t
+aarch64_architecture_trace_get_count (uint32_t core)
+{
+  if (core >= MICRO_OS_PLUS_INTEGER_SMP_MAX_CORES)
+    {
+      return 0;
+    }
+
+  uint64_t total = aarch64_architecture_trace_buffer.rings[core].total;
+  return (total < MICRO_OS_PLUS_INTEGER_TRACE_RECORDS)
+             ? static_cast<size_t> (total)
+             : MICRO_OS_PLUS_INTEGER_TRACE_RECORDS;
+}
+
+const aarch64_architecture_trace_record_t*
+aarch64_architecture_trace_get_record (uint32_t core, size_t index)
+{
+  size_t count = aarch64_architecture_trace_get_count (core);
+  if (index >= count)
+    {
+      return nullptr;
+    }
+
+  const aarch64_architecture_trace_ring_t* ring
+      = &aarch64_architecture_trace_buffer.rings[core];
+  uint64_t first = ring->total - count;
+  return &ring->records[(first + index)
+                        & (MICRO_OS_PLUS_INTEGER_TRACE_RECORDS - 1)];
+}
+
+int
+aarch64_architecture_trace_write (const char* path)
+{
+  uint32_t enabled = aarch64_architecture_trace_enabled;
+  aarch64_architecture_trace_stop ();
+
+  bool ok = false;
+  stream_t stream{ path, AARCH64_SEMIHOSTING_OPEN_WRITE_BINARY };
+  if (stream.is_open ())
+    {
+      aarch64_architecture_trace_file_t header{};
+      header.magic = AARCH64_TRACE_MAGIC;
+      header.version = AARCH64_TRACE_FILE_VERSION;
+      header.record_size = sizeof (aarch64_architecture_trace_record_t);
+      header.cores = MICRO_OS_PLUS_INTEGER_SMP_MAX_CORES;
+      header.records = MICRO_OS_PLUS_INTEGER_TRACE_RECORDS;
+      header.sequence = aarch64_architecture_trace_buffer.sequence;
+      header.frequency = aarch64_architecture_generic_timer_get_frequency ();
+      header.recovered = recovered ? 1 : 0;
+
+      ok = stream.write (&header, sizeof (header))
+           == static_cast<ptrdiff_t> (sizeof (header));
+
+      for (uint32_t core = 0; ok && core < MICRO_OS_PLUS_INTEGER_SMP_MAX_CORES;
+           ++core)
+        {
+          const aarch64_architecture_trace_ring_t* ring
+              = &aarch64_architecture_trace_buffer.rings[core];
+          size_t count = aarch64_architecture_trace_get_count (core);
+
+          aarch64_architecture_trace_file_ring_t ring_header{};
+          ring_header.core = core;
+          ring_header.count = static_cast<uint32_t> (count);
+          ring_header.total = ring->total;
+          ok = stream.write (&ring_header, sizeof (ring_header))
+               == static_cast<ptrdiff_t> (sizeof (ring_header));
+
+          // At most two runs, before and after the wrap.
+          size_t first = static_cast<size_t> (ring->total - count)
+                         & (MICRO_OS_PLUS_INTEGER_TRACE_RECORDS - 1);
+          size_t run = MICRO_OS_PLUS_INTEGER_TRACE_RECORDS - first;
+          if (run > count)
+            {
+              run = count;
+            }
+          size_t size = run * sizeof (aarch64_architecture_trace_record_t);
+          ok = ok
+               && stream.write (&ring->records[first], size)
+                      == static_cast<ptrdiff_t> (size);
+          size = (count - run) * sizeof (aarch64_architecture_trace_record_t);
+          ok = ok
+               && stream.write (&ring->records[0], size)
+                      == static_cast<ptrdiff_t> (size);
+        }
+
+      ok = stream.close () && ok;
+    }
+
+  if (enabled != 0)
+    {
+      aarch64_architecture_store_release_32 (
+          &aarch64_architecture_trace_enabled, 1);
+    }
+
+  return ok ? 0 : -1;
+}
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(MICRO_OS_PLUS_INCLUDE_TRACE)
+
+// ----------------------------------------------------------------------------
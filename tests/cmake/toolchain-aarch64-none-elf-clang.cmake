@@ -0,0 +1,61 @@
+# -----------------------------------------------------------------------------
+#
+# This file is part of the µOS++ distribution.
+#   (https://github.com/micro-os-plus/)
+# Copyright (c) 2026 Liviu Ionescu
+#
+# Permission to use, copy, modify, and/or distribute this software
+# for any purpose is hereby granted, under the terms of the MIT license.
+#
+# If a copy of the license was not distributed with this file, it can
+# be obtained from https://opensource.org/licenses/MIT/.
+#
+# -----------------------------------------------------------------------------
+
+# Toolchain for bare-metal AArch64 with clang, compiling against the
+# newlib and libstdc++ headers of the Arm GNU toolchain, which must also
+# be in the PATH. The link is done with aarch64-none-elf-g++, for the
+# `--specs` and the multilib libraries.
+
+set(CMAKE_SYSTEM_NAME Generic)
+set(CMAKE_SYSTEM_PROCESSOR aarch64)
+
+set(CMAKE_C_COMPILER clang)
+set(CMAKE_CXX_COMPILER clang++)
+set(CMAKE_ASM_COMPILER clang)
+
+set(triple aarch64-none-elf)
+set(CMAKE_C_COMPILER_TARGET ${triple})
+set(CMAKE_CXX_COMPILER_TARGET ${triple})
+set(CMAKE_ASM_COMPILER_TARGET ${triple})
+
+find_program(gcc_driver ${triple}-gcc REQUIRED)
+execute_process(
+  COMMAND ${gcc_driver} -print-sysroot
+  OUTPUT_VARIABLE gcc_sysroot
+  OUTPUT_STRIP_TRAILING_WHITESPACE
+)
+execute_process(
+  COMMAND ${gcc_driver} -dumpversion
+  OUTPUT_VARIABLE gcc_version
+  OUTPUT_STRIP_TRAILING_WHITESPACE
+)
+
+set(CMAKE_SYSROOT ${gcc_sysroot})
+
+# clang does not know the layout of the GNU toolchain C++ headers.
+set(libstdcxx_include "${gcc_sysroot}/include/c++/${gcc_version}")
+set(CMAKE_CXX_FLAGS_INIT
+  "-isystem ${libstdcxx_include} -isystem ${libstdcxx_include}/${triple}"
+)
+
+# Only the link flags and the objects are passed to the GNU driver;
+# the compile flags are clang specific.
+get_filename_component(gcc_bin ${gcc_driver} DIRECTORY)
+set(CMAKE_CXX_LINK_EXECUTABLE
+  "${gcc_bin}/${triple}-g++ <LINK_FLAGS> <OBJECTS> -o <TARGET> <LINK_LIBRARIES>"
+)
+
+set(CMAKE_TRY_COMPILE_TARGET_TYPE STATIC_LIBRARY)
+
+# -----------------------------------------------------------------------------
@@ -0,0 +1,31 @@
+# -----------------------------------------------------------------------------
+#
+# This file is part of the µOS++ distribution.
+#   (https://github.com/micro-os-plus/)
+# Copyright (c) 2026 Liviu Ionescu
+#
+# Permission to use, copy, modify, and/or distribute this software
+# for any purpose is hereby granted, under the terms of the MIT license.
+#
+# If a copy of the license was not distributed with this file, it can
+# be obtained from https://opensource.org/licenses/MIT/.
+#
+# -----------------------------------------------------------------------------
+
+# Toolchain for bare-metal AArch64 with the Arm GNU toolchain
+# (aarch64-none-elf-gcc), with newlib.
+
+set(CMAKE_SYSTEM_NAME Generic)
+set(CMAKE_SYSTEM_PROCESSOR aarch64)
+
+set(CMAKE_C_COMPILER aarch64-none-elf-gcc)
+set(CMAKE_CXX_COMPILER aarch64-none-elf-g++)
+set(CMAKE_ASM_COMPILER aarch64-none-elf-gcc)
+
+set(CMAKE_OBJCOPY aarch64-none-elf-objcopy)
+set(CMAKE_SIZE aarch64-none-elf-size)
+
+# Without a startup file, only libraries can be linked by try_compile().
+set(CMAKE_TRY_COMPILE_TARGET_TYPE STATIC_LIBRARY)
+
+# -----------------------------------------------------------------------------
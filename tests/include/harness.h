@@ -0,0 +1,136 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_AARCH64_TESTS_HARNESS_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_AARCH64_TESTS_HARNESS_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// A minimal benchmark and test harness, for bare-metal runs under QEMU.
+//
+// Each benchmark runs its body `iterations` times in a loop, repeated
+// `repetitions` times; the PMU cycle counter and the generic timer
+// counter are read around each loop, and the minimum and the median
+// of the repetitions are kept. The cost of the empty loop is measured
+// first, and subtracted in the `net` column.
+//
+// Under QEMU (TCG) the cycle counter is derived from the host time,
+// so the numbers are useful to compare primitives with each other and
+// to detect regressions, not as absolute hardware figures.
+
+namespace micro_os_plus::architecture::tests
+{
+  // --------------------------------------------------------------------------
+
+  constexpr size_t repetitions = 11;
+
+  /**
+   * The per-repetition totals of one benchmark; `cycles` may be
+   * null if only the timer counter was measured.
+   */
+  void
+  record (const char* name, uint32_t iterations, const uint64_t* cycles,
+          const uint64_t* ticks);
+
+  /**
+   * Measure the empty loop, to be subtracted from the other results.
+   */
+  void
+  record_overhead (uint32_t iterations);
+
+  /**
+   * Run `body` `iterations` times, `repetitions` times, and record the
+   * totals. The empty asm statement after each call prevents the
+   * compiler from merging or hoisting the iterations.
+   */
+  template <typename F>
+  __attribute__ ((noinline)) void
+  run (const char* name, uint32_t iterations, F&& body)
+  {
+    uint64_t cycles[repetitions];
+    uint64_t ticks[repetitions];
+
+    // Warm the caches and the branch predictors.
+    body ();
+
+    for (size_t r = 0; r < repetitions; ++r)
+      {
+        aarch64_architecture_isb ();
+        uint64_t c0 = aarch64_architecture_pmu_get_cycle_counter ();
+        uint64_t t0 = aarch64_architecture_generic_timer_get_counter ();
+
+        for (uint32_t i = 0; i < iterations; ++i)
+          {
+            body ();
+            __asm__ volatile("" : : : "memory");
+          }
+
+        aarch64_architecture_isb ();
+        uint64_t t1 = aarch64_architecture_generic_timer_get_counter ();
+        uint64_t c1 = aarch64_architecture_pmu_get_cycle_counter ();
+
+        cycles[r] = c1 - c0;
+        ticks[r] = t1 - t0;
+      }
+
+    record (name, iterations, cycles, ticks);
+  }
+
+  /**
+   * Write the results as CSV, or as JSON, to a host file;
+   * `":tt"` is the console. Return false on error.
+   */
+  bool
+  write_csv (const char* path);
+
+  bool
+  write_json (const char* path);
+
+  /**
+   * Count and report a failed check.
+   */
+  bool
+  check (bool condition, const char* what, const char* file, int line);
+
+  /**
+   * The number of failed checks.
+   */
+  uint32_t
+  failures (void);
+
+  /**
+   * The correctness tests and the benchmarks.
+   */
+  void
+  run_tests (void);
+
+  void
+  run_benchmarks (void);
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::architecture::tests
+
+#define CHECK(condition)                                                      \
+  micro_os_plus::architecture::tests::check ((condition), #condition,        \
+                                             __FILE__, __LINE__)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_AARCH64_TESTS_HARNESS_H_
+
+// ----------------------------------------------------------------------------
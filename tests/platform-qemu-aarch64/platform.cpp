@@ -0,0 +1,58 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture.h>
+
+#include <cstdlib>
+
+// ----------------------------------------------------------------------------
+
+extern "C"
+{
+  // From librdimon; the newlib `crt0.S` is not used.
+  void
+  initialise_monitor_handles (void);
+
+  int
+  main (void);
+
+  void
+  platform_start (void) __attribute__ ((noreturn));
+}
+
+// ----------------------------------------------------------------------------
+
+/**
+ * Continue the startup in C++, after `Reset_Handler` initialised
+ * the stack, the MMU and the memory.
+ */
+void
+platform_start (void)
+{
+  aarch64_architecture_exception_vectors_install ();
+
+  // From now on the startup stack is the thread stack, on SP_EL0.
+  aarch64_architecture_interrupts_stack_install ();
+
+  initialise_monitor_handles ();
+
+  // Like `__libc_init_array()`, with each constructor timed.
+  aarch64_architecture_init_profiler_init_array ();
+
+  // Runs the `atexit()` handlers and the static destructors, then
+  // leaves QEMU via semihosting, with the exit code.
+  std::exit (main ());
+}
+
+// ----------------------------------------------------------------------------
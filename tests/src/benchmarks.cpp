@@ -0,0 +1,490 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <harness.h>
+
+#include <cstdlib>
+#include <cstring>
+
+// ----------------------------------------------------------------------------
+
+namespace micro_os_plus::architecture::tests
+{
+  namespace
+  {
+    constexpr uint32_t iterations = 1000;
+    constexpr uint32_t slow_iterations = 100;
+
+#if defined(MICRO_OS_PLUS_USE_GENERIC_TIMER_PHYSICAL)
+    constexpr uint32_t timer_intid = AARCH64_GIC_INTID_TIMER_PHYSICAL;
+#else
+    constexpr uint32_t timer_intid = AARCH64_GIC_INTID_TIMER_VIRTUAL;
+#endif // defined(MICRO_OS_PLUS_USE_GENERIC_TIMER_PHYSICAL)
+
+    constexpr uint32_t sgi_intid = 0;
+
+    alignas (64) uint8_t source[4096];
+    alignas (64) uint8_t destination[4096 + 64];
+
+    alignas (64) volatile uint32_t word32;
+    alignas (64) volatile uint64_t word64;
+
+    aarch64_architecture_ticket_lock_t ticket_lock;
+    aarch64_architecture_mcs_lock_t mcs_lock;
+
+    volatile uint32_t sgi_count;
+
+    void
+    sgi_handler (void* arg, aarch64_architecture_exception_frame_t* frame)
+    {
+      (void)arg;
+      (void)frame;
+      sgi_count = sgi_count + 1;
+    }
+
+    void
+    benchmark_instructions (void)
+    {
+      run ("instructions.nop", iterations,
+           [] { aarch64_architecture_nop (); });
+      run ("instructions.isb", iterations,
+           [] { aarch64_architecture_isb (); });
+      run ("instructions.sevl_wfe", iterations, [] {
+        aarch64_architecture_sevl ();
+        aarch64_architecture_wfe ();
+      });
+      run ("instructions.clrex", iterations,
+           [] { aarch64_architecture_clrex (); });
+
+      run ("barriers.dmb_ish", iterations,
+           [] { aarch64_architecture_dmb_ish (); });
+      run ("barriers.dmb_ishld", iterations,
+           [] { aarch64_architecture_dmb_ishld (); });
+      run ("barriers.dmb_ishst", iterations,
+           [] { aarch64_architecture_dmb_ishst (); });
+      run ("barriers.dmb_sy", iterations,
+           [] { aarch64_architecture_dmb_sy (); });
+      run ("barriers.dsb_ish", iterations,
+           [] { aarch64_architecture_dsb_ish (); });
+      run ("barriers.dsb_sy", iterations,
+           [] { aarch64_architecture_dsb_sy (); });
+
+      run ("accessors.load_acquire_64", iterations,
+           [] { (void)aarch64_architecture_load_acquire_64 (&word64); });
+      run ("accessors.store_release_64", iterations,
+           [] { aarch64_architecture_store_release_64 (&word64, 1); });
+    }
+
+    void
+    benchmark_counters (void)
+    {
+      run ("generic_timer.get_counter", iterations, [] {
+        (void)aarch64_architecture_generic_timer_get_counter ();
+      });
+      run ("generic_timer.get_frequency", iterations, [] {
+        (void)aarch64_architecture_generic_timer_get_frequency ();
+      });
+      run ("pmu.get_cycle_counter", iterations,
+           [] { (void)aarch64_architecture_pmu_get_cycle_counter (); });
+    }
+
+    void
+    benchmark_registers (void)
+    {
+      using namespace aarch64::architecture::registers;
+
+      uint64_t saved = sysreg<"TPIDR_EL0">::read ();
+
+      run ("registers.get_sp", iterations,
+           [] { (void)aarch64_architecture_get_sp (); });
+      run ("registers.sysreg_read", iterations,
+           [] { (void)sysreg<"TPIDR_EL0">::read (); });
+      // One read and one write for the three fields.
+      run ("registers.sysreg_modify_3", iterations, [] {
+        sysreg<"TPIDR_EL0">::modify (
+            field<"TPIDR_EL0", 0, 8, uint32_t>{}(1),
+            field<"TPIDR_EL0", 8, 8, uint32_t>{}(2),
+            field<"TPIDR_EL0", 16, 1, bool>{}(true));
+      });
+
+      sysreg<"TPIDR_EL0">::write (saved);
+    }
+
+    void
+    benchmark_atomics (void)
+    {
+      run ("atomics.fetch_add_32", iterations,
+           [] { aarch64_architecture_atomic_fetch_add_32 (&word32, 1); });
+      run ("atomics.fetch_add_64", iterations,
+           [] { aarch64_architecture_atomic_fetch_add_64 (&word64, 1); });
+      run ("atomics.compare_exchange_32", iterations, [] {
+        uint32_t value = word32;
+        aarch64_architecture_atomic_compare_exchange_32 (&word32, value,
+                                                         value + 1);
+      });
+      run ("atomics.swap_64", iterations,
+           [] { aarch64_architecture_atomic_swap_64 (&word64, 1); });
+      run ("atomics.test_and_set_clear", iterations, [] {
+        aarch64_architecture_atomic_test_and_set (&word32);
+        aarch64_architecture_atomic_clear (&word32);
+      });
+
+      run ("spinlocks.ticket_acquire_release", iterations, [] {
+        aarch64_architecture_ticket_lock_acquire (&ticket_lock);
+        aarch64_architecture_ticket_lock_release (&ticket_lock);
+      });
+      run ("spinlocks.mcs_acquire_release", iterations, [] {
+        aarch64_architecture_mcs_node_t node;
+        aarch64_architecture_mcs_lock_acquire (&mcs_lock, &node);
+        aarch64_architecture_mcs_lock_release (&mcs_lock, &node);
+      });
+    }
+
+    void
+    benchmark_cache (void)
+    {
+      run ("cache.dcache_clean_line", iterations, [] {
+        aarch64_architecture_dcache_clean (destination, 64);
+      });
+      run ("cache.dcache_clean_invalidate_line", iterations, [] {
+        aarch64_architecture_dcache_clean_invalidate (destination, 64);
+      });
+      run ("cache.icache_sync_line", iterations, [] {
+        aarch64_architecture_icache_sync (destination, 64);
+      });
+    }
+
+    void
+    benchmark_semihosting (void)
+    {
+      run ("semihosting.call_host", slow_iterations, [] {
+        (void)micro_os_plus_semihosting_call_host (
+            AARCH64_SEMIHOSTING_SYS_ERRNO, nullptr);
+      });
+
+      static const char path[] = "benchmarks.tmp";
+      static aarch64::architecture::semihosting::stream<> stream;
+      if (!stream.open (path, AARCH64_SEMIHOSTING_OPEN_WRITE_BINARY))
+        {
+          return;
+        }
+
+      // Buffered, most calls only store the byte.
+      run ("semihosting.stream_putc", iterations,
+           [] { stream.putc ('x'); });
+      run ("semihosting.stream_write_64", slow_iterations,
+           [] { stream.write (source, 64); });
+      stream.close ();
+
+      micro_os_plus_semihosting_param_block_t block[2]
+          = { reinterpret_cast<micro_os_plus_semihosting_param_block_t> (
+                  path),
+              sizeof (path) - 1 };
+      (void)micro_os_plus_semihosting_call_host (
+          AARCH64_SEMIHOSTING_SYS_REMOVE, block);
+    }
+
+    void
+    benchmark_strings (void)
+    {
+      for (size_t i = 0; i < sizeof (source); ++i)
+        {
+          source[i] = static_cast<uint8_t> ('a' + i % 26);
+        }
+      source[sizeof (source) - 1] = '\0';
+
+      run ("strings.memcpy_16", iterations,
+           [] { std::memcpy (destination, source, 16); });
+      run ("strings.memcpy_256", iterations,
+           [] { std::memcpy (destination, source, 256); });
+      run ("strings.memcpy_4096", slow_iterations,
+           [] { std::memcpy (destination, source, 4096); });
+      run ("strings.memcpy_4096_unaligned", slow_iterations,
+           [] { std::memcpy (destination + 3, source + 1, 4095); });
+      run ("strings.memmove_256_overlap", iterations,
+           [] { std::memmove (destination + 8, destination, 256); });
+      run ("strings.memset_256", iterations,
+           [] { std::memset (destination, 0, 256); });
+      run ("strings.memset_4096", slow_iterations,
+           [] { std::memset (destination, 0, 4096); });
+
+      std::memcpy (destination, source, sizeof (source));
+      run ("strings.memcmp_256", iterations, [] {
+        (void)std::memcmp (destination, source, 256);
+      });
+      run ("strings.memcmp_4096", slow_iterations, [] {
+        (void)std::memcmp (destination, source, 4096);
+      });
+      run ("strings.strlen_4095", slow_iterations, [] {
+        (void)std::strlen (reinterpret_cast<const char*> (source));
+      });
+    }
+
+    void
+    benchmark_stacks (void)
+    {
+      // A 4 KB stack, never used.
+      run ("stacks.fill_4096", slow_iterations, [] {
+        aarch64_architecture_stack_fill (destination,
+                                         destination + 4096);
+      });
+      run ("stacks.get_unused_4096", slow_iterations, [] {
+        (void)aarch64_architecture_stack_get_unused (destination,
+                                                     destination + 4096);
+      });
+    }
+
+    void
+    benchmark_crypto (void)
+    {
+      using namespace aarch64::architecture;
+
+      static crypto::aes_gcm gcm;
+      static uint8_t iv[AARCH64_AES_GCM_IV_SIZE];
+      static uint8_t tag[AARCH64_AES_GCM_TAG_SIZE];
+      static uint8_t digest[AARCH64_SHA256_DIGEST_SIZE];
+      gcm.set_key (source, 16);
+
+      run ("crypto.crc32_4096", slow_iterations,
+           [] { (void)crypto::crc32 (source, 4096); });
+      run ("crypto.crc32c_4096", slow_iterations,
+           [] { (void)crypto::crc32c (source, 4096); });
+      run ("crypto.aes_gcm_encrypt_4096", slow_iterations, [] {
+        gcm.encrypt (iv, nullptr, 0, source, destination, 4096, tag);
+      });
+      run ("crypto.sha256_4096", slow_iterations,
+           [] { crypto::sha256 (source, 4096, digest); });
+    }
+
+    void
+    benchmark_memory (void)
+    {
+      using namespace aarch64::architecture;
+
+      memory::initialize_heap (64 * 1024);
+
+      run ("memory.allocate_free_64", iterations,
+           [] { memory::deallocate (memory::allocate (64)); });
+      run ("memory.malloc_free_64", iterations, [] {
+        void* volatile block = std::malloc (64);
+        std::free (block);
+      });
+    }
+
+    void
+    benchmark_queues (void)
+    {
+      using namespace aarch64::architecture;
+
+      static spsc_queue<64> spsc;
+      static mpmc_queue<64> mpmc;
+      static uint64_t messages[16];
+
+      run ("queues.spsc_push_pop", iterations, [] {
+        uint64_t message;
+        spsc.push (1);
+        (void)spsc.pop (message);
+      });
+      run ("queues.spsc_push_pop_16", iterations, [] {
+        spsc.push (messages, 16);
+        (void)spsc.pop (messages, 16);
+      });
+      run ("queues.mpmc_push_pop", iterations, [] {
+        uint64_t message;
+        mpmc.push (1);
+        (void)mpmc.pop (message);
+      });
+      run ("queues.mpmc_push_pop_16", iterations, [] {
+        mpmc.push (messages, 16);
+        (void)mpmc.pop (messages, 16);
+      });
+    }
+
+    void
+    benchmark_syscalls (void)
+    {
+      using namespace aarch64::architecture;
+
+      // Round trips to the null handler in the tests table.
+      run ("syscalls.svc_immediate", iterations,
+           [] { (void)syscalls::call<3> (); });
+      run ("syscalls.svc_x8", iterations, [] { (void)syscalls::call (3); });
+    }
+
+    void
+    benchmark_trace (void)
+    {
+      using namespace aarch64::architecture;
+
+      // Started by the tests.
+      run ("trace.event", iterations, [] { trace::event (1, 2, 3); });
+
+      trace::stop ();
+      run ("trace.event_stopped", iterations,
+           [] { trace::event (1, 2, 3); });
+      trace::start ();
+    }
+
+    void
+    benchmark_clock (void)
+    {
+      using namespace aarch64::architecture;
+
+      run ("clock.ticks", iterations, [] { (void)clock::ticks (); });
+      run ("clock.ns", iterations, [] { (void)clock::ns (); });
+      run ("clock.chrono_now", iterations, [] {
+        (void)micro_os_plus::architecture::monotonic_clock::now ();
+      });
+
+      // The conversion it replaces.
+      run ("clock.ns_divide", iterations, [] {
+        uint64_t ticks = clock::ticks ();
+        uint64_t frequency = aarch64_architecture_clock.frequency;
+        (void)(ticks / frequency * 1000000000u
+               + ticks % frequency * 1000000000u / frequency);
+      });
+    }
+
+    void
+    benchmark_dsp (void)
+    {
+      using namespace aarch64::architecture;
+
+      static float a[1024];
+      static float b[1024 + 15];
+      static float out[1024];
+      static int8_t matrix[64 * 256];
+      static dsp::float16_t matrix_f16[64 * 256];
+      static int32_t y[64];
+      static float y_f16[64];
+      static float low;
+      static float high;
+
+      // The best implementation, ASIMD only and the portable code.
+      static const struct
+      {
+        uint32_t features;
+        const char* names[5];
+      } selections[] = {
+        { AARCH64_DSP_FEATURE_ASIMD | AARCH64_DSP_FEATURE_SVE,
+          { "dsp.dot_1024", "dsp.fir_16x1024", "dsp.gemv_s8_64x256",
+            "dsp.gemv_f16_64x256", "dsp.min_max_1024" } },
+        { AARCH64_DSP_FEATURE_ASIMD,
+          { "dsp.dot_1024_asimd", "dsp.fir_16x1024_asimd",
+            "dsp.gemv_s8_64x256_asimd", "dsp.gemv_f16_64x256_asimd",
+            "dsp.min_max_1024_asimd" } },
+        { 0,
+          { "dsp.dot_1024_portable", "dsp.fir_16x1024_portable",
+            "dsp.gemv_s8_64x256_portable", "dsp.gemv_f16_64x256_portable",
+            "dsp.min_max_1024_portable" } },
+      };
+
+      uint32_t features = dsp::features ();
+      for (const auto& selection : selections)
+        {
+          aarch64_architecture_dsp_select_features (selection.features);
+
+          run (selection.names[0], slow_iterations,
+               [] { (void)dsp::dot (a, b, 1024); });
+          run (selection.names[1], slow_iterations,
+               [] { dsp::fir (a, 16, b, out, 1024); });
+          run (selection.names[2], slow_iterations,
+               [] { dsp::gemv (matrix, matrix, y, 64, 256); });
+          run (selection.names[3], slow_iterations,
+               [] { dsp::gemv (matrix_f16, matrix_f16, y_f16, 64, 256); });
+          run (selection.names[4], slow_iterations,
+               [] { (void)dsp::min_max (a, 1024, low, high); });
+        }
+      aarch64_architecture_dsp_select_features (features);
+    }
+
+    void
+    benchmark_interrupts (void)
+    {
+      // Round trip of a software generated interrupt to self: send,
+      // take the exception, dispatch, return.
+      aarch64_architecture_gic_set_handler (sgi_intid, sgi_handler, nullptr);
+      aarch64_architecture_gic_enable (sgi_intid);
+
+      run ("gic.sgi_round_trip", slow_iterations, [] {
+        uint32_t count = sgi_count;
+        aarch64_architecture_gic_send_sgi (
+            sgi_intid, aarch64_architecture_get_mpidr ());
+        while (sgi_count == count)
+          {
+          }
+      });
+
+      aarch64_architecture_gic_disable (sgi_intid);
+
+      // The time from the timer deadline to the first instruction after
+      // `wfi`; with IRQs masked the core wakes up without taking the
+      // exception. Only the timer counter is meaningful.
+      uint64_t ticks[repetitions];
+      uint64_t delta
+          = aarch64_architecture_generic_timer_get_frequency () / 10000;
+
+      aarch64_architecture_interrupts_disable ();
+      aarch64_architecture_gic_enable (timer_intid);
+
+      for (size_t r = 0; r < repetitions; ++r)
+        {
+          uint64_t deadline
+              = aarch64_architecture_generic_timer_get_counter () + delta;
+          uint64_t now;
+          do
+            {
+              aarch64_architecture_generic_timer_sleep_until (deadline);
+              now = aarch64_architecture_generic_timer_get_counter ();
+            }
+          while (now < deadline);
+          ticks[r] = now - deadline;
+        }
+
+      aarch64_architecture_gic_disable (timer_intid);
+      aarch64_architecture_interrupts_enable ();
+
+      record ("generic_timer.wfi_wake_latency", 1, nullptr, ticks);
+    }
+  } // namespace
+
+  // --------------------------------------------------------------------------
+
+  void
+  run_benchmarks (void)
+  {
+    record_overhead (iterations);
+
+    benchmark_instructions ();
+    benchmark_counters ();
+    benchmark_registers ();
+    benchmark_atomics ();
+    benchmark_cache ();
+    benchmark_semihosting ();
+    benchmark_strings ();
+    benchmark_stacks ();
+    benchmark_crypto ();
+    benchmark_memory ();
+    benchmark_queues ();
+    benchmark_syscalls ();
+    benchmark_trace ();
+    benchmark_clock ();
+    benchmark_dsp ();
+    benchmark_interrupts ();
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::architecture::tests
+
+// ----------------------------------------------------------------------------
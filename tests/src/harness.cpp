@@ -0,0 +1,255 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <harness.h>
+
+#include <cstdio>
+
+// ----------------------------------------------------------------------------
+
+namespace micro_os_plus::architecture::tests
+{
+  namespace
+  {
+    struct result_s
+    {
+      const char* name;
+      uint32_t iterations;
+      bool has_cycles;
+      uint64_t cycles_min;
+      uint64_t cycles_median;
+      uint64_t ticks_min;
+      uint64_t ticks_median;
+    };
+
+    constexpr size_t max_results = 128;
+
+    result_s results[max_results];
+    size_t results_count;
+
+    // Per iteration, in cycles and ticks, scaled by 1000.
+    uint64_t overhead_cycles;
+    uint64_t overhead_ticks;
+
+    uint32_t failures_count;
+
+    using stream_t = aarch64::architecture::semihosting::stream<>;
+
+    // Sorts a copy, the sets are small.
+    void
+    min_median (const uint64_t* values, uint64_t* min, uint64_t* median)
+    {
+      uint64_t sorted[repetitions];
+      for (size_t i = 0; i < repetitions; ++i)
+        {
+          uint64_t value = values[i];
+          size_t j = i;
+          for (; j > 0 && sorted[j - 1] > value; --j)
+            {
+              sorted[j] = sorted[j - 1];
+            }
+          sorted[j] = value;
+        }
+
+      *min = sorted[0];
+      *median = sorted[repetitions / 2];
+    }
+
+    double
+    per_iteration (uint64_t total, const result_s& result)
+    {
+      return static_cast<double> (total) / result.iterations;
+    }
+
+    double
+    net (uint64_t total, uint64_t overhead, const result_s& result)
+    {
+      double value = per_iteration (total, result)
+                     - static_cast<double> (overhead) / 1000.0;
+      return (value < 0) ? 0 : value;
+    }
+
+    double
+    nanoseconds (double ticks)
+    {
+      return ticks * 1e9
+             / static_cast<double> (
+                 aarch64_architecture_generic_timer_get_frequency ());
+    }
+
+    bool
+    put_line (stream_t& stream, const char* line)
+    {
+      return stream.puts (line) >= 0;
+    }
+  } // namespace
+
+  // --------------------------------------------------------------------------
+
+  void
+  record (const char* name, uint32_t iterations, const uint64_t* cycles,
+          const uint64_t* ticks)
+  {
+    if (results_count == max_results || iterations == 0)
+      {
+        return;
+      }
+
+    result_s& result = results[results_count++];
+    result.name = name;
+    result.iterations = iterations;
+    result.has_cycles = (cycles != nullptr);
+    if (result.has_cycles)
+      {
+        min_median (cycles, &result.cycles_min, &result.cycles_median);
+      }
+    min_median (ticks, &result.ticks_min, &result.ticks_median);
+  }
+
+  void
+  record_overhead (uint32_t iterations)
+  {
+    overhead_cycles = 0;
+    overhead_ticks = 0;
+
+    run ("overhead.loop", iterations, [] {});
+
+    const result_s& result = results[results_count - 1];
+    overhead_cycles = result.cycles_min * 1000 / iterations;
+    overhead_ticks = result.ticks_min * 1000 / iterations;
+  }
+
+  bool
+  write_csv (const char* path)
+  {
+    stream_t stream{ path, AARCH64_SEMIHOSTING_OPEN_WRITE };
+    if (!stream.is_open ())
+      {
+        return false;
+      }
+
+    char line[256];
+    bool ok = put_line (stream,
+                        "name,iterations,cycles_min,cycles_median,"
+                        "cycles_net,ns_min,ns_median,ns_net\n");
+    for (size_t i = 0; ok && i < results_count; ++i)
+      {
+        const result_s& r = results[i];
+        if (r.has_cycles)
+          {
+            std::snprintf (
+                line, sizeof (line),
+                "%s,%lu,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f\n", r.name,
+                static_cast<unsigned long> (r.iterations),
+                per_iteration (r.cycles_min, r),
+                per_iteration (r.cycles_median, r),
+                net (r.cycles_median, overhead_cycles, r),
+                nanoseconds (per_iteration (r.ticks_min, r)),
+                nanoseconds (per_iteration (r.ticks_median, r)),
+                nanoseconds (net (r.ticks_median, overhead_ticks, r)));
+          }
+        else
+          {
+            std::snprintf (line, sizeof (line), "%s,%lu,,,,%.2f,%.2f,\n",
+                           r.name, static_cast<unsigned long> (r.iterations),
+                           nanoseconds (per_iteration (r.ticks_min, r)),
+                           nanoseconds (per_iteration (r.ticks_median, r)));
+          }
+        ok = put_line (stream, line);
+      }
+
+    return stream.close () && ok;
+  }
+
+  bool
+  write_json (const char* path)
+  {
+    stream_t stream{ path, AARCH64_SEMIHOSTING_OPEN_WRITE };
+    if (!stream.is_open ())
+      {
+        return false;
+      }
+
+    char line[384];
+    std::snprintf (
+        line, sizeof (line),
+        "{\n  \"timer_frequency\": %lu,\n  \"repetitions\": %lu,\n"
+        "  \"results\": [\n",
+        static_cast<unsigned long> (
+            aarch64_architecture_generic_timer_get_frequency ()),
+        static_cast<unsigned long> (repetitions));
+    bool ok = put_line (stream, line);
+
+    for (size_t i = 0; ok && i < results_count; ++i)
+      {
+        const result_s& r = results[i];
+        const char* separator = (i + 1 < results_count) ? "," : "";
+        if (r.has_cycles)
+          {
+            std::snprintf (
+                line, sizeof (line),
+                "    { \"name\": \"%s\", \"iterations\": %lu, "
+                "\"cycles_min\": %.2f, \"cycles_median\": %.2f, "
+                "\"cycles_net\": %.2f, \"ns_min\": %.2f, "
+                "\"ns_median\": %.2f, \"ns_net\": %.2f }%s\n",
+                r.name, static_cast<unsigned long> (r.iterations),
+                per_iteration (r.cycles_min, r),
+                per_iteration (r.cycles_median, r),
+                net (r.cycles_median, overhead_cycles, r),
+                nanoseconds (per_iteration (r.ticks_min, r)),
+                nanoseconds (per_iteration (r.ticks_median, r)),
+                nanoseconds (net (r.ticks_median, overhead_ticks, r)),
+                separator);
+          }
+        else
+          {
+            std::snprintf (
+                line, sizeof (line),
+                "    { \"name\": \"%s\", \"iterations\": %lu, "
+                "\"cycles_min\": null, \"cycles_median\": null, "
+                "\"cycles_net\": null, \"ns_min\": %.2f, "
+                "\"ns_median\": %.2f, \"ns_net\": null }%s\n",
+                r.name, static_cast<unsigned long> (r.iterations),
+                nanoseconds (per_iteration (r.ticks_min, r)),
+                nanoseconds (per_iteration (r.ticks_median, r)), separator);
+          }
+        ok = put_line (stream, line);
+      }
+
+    ok = ok && put_line (stream, "  ]\n}\n");
+
+    return stream.close () && ok;
+  }
+
+  bool
+  check (bool condition, const char* what, const char* file, int line)
+  {
+    if (!condition)
+      {
+        ++failures_count;
+        std::printf ("FAIL %s:%d: %s\n", file, line, what);
+      }
+    return condition;
+  }
+
+  uint32_t
+  failures (void)
+  {
+    return failures_count;
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::architecture::tests
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,53 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <harness.h>
+
+#include <cstdio>
+
+// ----------------------------------------------------------------------------
+
+using namespace micro_os_plus::architecture;
+
+int
+main (void)
+{
+  std::printf ("µOS++ AArch64 architecture tests and benchmarks\n");
+
+  aarch64_architecture_pmu_enable ();
+
+  aarch64_architecture_gic_initialize ();
+  aarch64_architecture_interrupts_enable ();
+
+  tests::run_tests ();
+  std::printf ("Tests: %lu failure(s)\n",
+               static_cast<unsigned long> (tests::failures ()));
+
+  tests::run_benchmarks ();
+
+  // The console first, then the files, in the QEMU working folder.
+  bool ok = tests::write_csv (AARCH64_SEMIHOSTING_CONSOLE_PATH);
+  ok = tests::write_csv ("benchmarks.csv") && ok;
+  ok = tests::write_json ("benchmarks.json") && ok;
+  ok = aarch64::architecture::init_profiler::write ("init-profile.csv")
+       && ok;
+  if (!ok)
+    {
+      std::printf ("Cannot write the results\n");
+    }
+
+  return (ok && tests::failures () == 0) ? 0 : 1;
+}
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,1398 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2026 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <harness.h>
+
+#include <cstring>
+#include <limits>
+
+// ----------------------------------------------------------------------------
+
+extern "C"
+{
+  // Defined by the linker script.
+  extern char __text_hot_start__[];
+  extern char __text_hot_end__[];
+  extern char __fast_text_start__[];
+  extern char __fast_text_end__[];
+  extern char __data_read_mostly_start__[];
+  extern char __data_read_mostly_end__[];
+  extern char __data_write_hot_start__[];
+  extern char __data_write_hot_end__[];
+}
+
+// ----------------------------------------------------------------------------
+
+namespace micro_os_plus::architecture::tests
+{
+  namespace
+  {
+    constexpr size_t max_size = 300;
+    constexpr size_t max_alignment = 16;
+    constexpr size_t guard = 32;
+    constexpr size_t buffer_size = guard + max_alignment + max_size + guard;
+
+    alignas (64) uint8_t buffer_a[buffer_size];
+    alignas (64) uint8_t buffer_b[buffer_size];
+    alignas (64) uint8_t expected[buffer_size];
+
+    uint32_t random_state = 0x12345678;
+
+    uint8_t
+    random_byte (void)
+    {
+      // xorshift32, reproducible.
+      random_state ^= random_state << 13;
+      random_state ^= random_state >> 17;
+      random_state ^= random_state << 5;
+      return static_cast<uint8_t> (random_state);
+    }
+
+    void
+    fill_random (uint8_t* buffer)
+    {
+      for (size_t i = 0; i < buffer_size; ++i)
+        {
+          buffer[i] = random_byte ();
+        }
+    }
+
+    // The references use volatile byte accesses, so the compiler
+    // cannot turn them into calls to the functions under test.
+
+    void
+    reference_move (uint8_t* destination, const uint8_t* source, size_t n)
+    {
+      volatile uint8_t* d = destination;
+      const volatile uint8_t* s = source;
+      if (d < s)
+        {
+          for (size_t i = 0; i < n; ++i)
+            {
+              d[i] = s[i];
+            }
+        }
+      else
+        {
+          for (size_t i = n; i > 0; --i)
+            {
+              d[i - 1] = s[i - 1];
+            }
+        }
+    }
+
+    int
+    reference_compare (const uint8_t* a, const uint8_t* b, size_t n)
+    {
+      const volatile uint8_t* x = a;
+      const volatile uint8_t* y = b;
+      for (size_t i = 0; i < n; ++i)
+        {
+          if (x[i] != y[i])
+            {
+              return (x[i] < y[i]) ? -1 : 1;
+            }
+        }
+      return 0;
+    }
+
+    int
+    sign (int value)
+    {
+      return (value > 0) - (value < 0);
+    }
+
+    bool
+    same (const uint8_t* a, const uint8_t* b)
+    {
+      return reference_compare (a, b, buffer_size) == 0;
+    }
+
+    // Zero fills around and above the `dc zva` threshold (160 bytes),
+    // over several 64 bytes blocks.
+    constexpr size_t zva_block = 64;
+    constexpr size_t zero_max_size = 16 * zva_block + 1;
+    constexpr size_t zero_buffer_size
+        = guard + zva_block + zero_max_size + guard;
+
+    alignas (64) uint8_t zero_buffer[zero_buffer_size];
+    alignas (64) uint8_t zero_expected[zero_buffer_size];
+
+    void
+    test_memcpy_memset (void)
+    {
+      for (size_t size = 0; size <= max_size; ++size)
+        {
+          for (size_t da = 0; da < max_alignment; ++da)
+            {
+              size_t sa = (da + size) % max_alignment;
+
+              fill_random (buffer_a);
+              fill_random (buffer_b);
+              reference_move (expected, buffer_b, buffer_size);
+              reference_move (expected + guard + da, buffer_a + guard + sa,
+                              size);
+              void* result = std::memcpy (buffer_b + guard + da,
+                                          buffer_a + guard + sa, size);
+              if (!CHECK (result == buffer_b + guard + da)
+                  || !CHECK (same (buffer_b, expected)))
+                {
+                  return;
+                }
+
+              int value = random_byte ();
+              volatile uint8_t* e = expected + guard + da;
+              for (size_t i = 0; i < size; ++i)
+                {
+                  e[i] = static_cast<uint8_t> (value);
+                }
+              result = std::memset (buffer_b + guard + da, value, size);
+              if (!CHECK (result == buffer_b + guard + da)
+                  || !CHECK (same (buffer_b, expected)))
+                {
+                  return;
+                }
+            }
+        }
+
+      // The random values above are seldom 0; clear explicitly, at all
+      // the destination alignments within a block.
+      static const size_t zero_sizes[]
+          = { 159, 160, 161, 191, 192, 193, 255, 256, 257,
+              320, 511, 512, 513, 1023, 1024, zero_max_size };
+      for (size_t size : zero_sizes)
+        {
+          for (size_t da = 0; da < zva_block; ++da)
+            {
+              // Non-zero, so the bytes not written are detected.
+              for (size_t i = 0; i < zero_buffer_size; ++i)
+                {
+                  zero_buffer[i] = static_cast<uint8_t> (random_byte () | 1);
+                }
+              reference_move (zero_expected, zero_buffer, zero_buffer_size);
+              volatile uint8_t* e = zero_expected + guard + da;
+              for (size_t i = 0; i < size; ++i)
+                {
+                  e[i] = 0;
+                }
+
+              void* result = std::memset (zero_buffer + guard + da, 0, size);
+              if (!CHECK (result == zero_buffer + guard + da)
+                  || !CHECK (reference_compare (zero_buffer, zero_expected,
+                                                zero_buffer_size)
+                             == 0))
+                {
+                  return;
+                }
+            }
+        }
+    }
+
+    void
+    test_memmove (void)
+    {
+      for (size_t size = 0; size <= max_size; size += 7)
+        {
+          for (size_t shift = 0; shift < max_alignment * 2; ++shift)
+            {
+              // Both directions, overlapping by all but `shift` bytes.
+              size_t low = guard;
+              size_t high = guard + shift;
+              if (high + size > buffer_size)
+                {
+                  continue;
+                }
+
+              fill_random (buffer_a);
+              reference_move (expected, buffer_a, buffer_size);
+              reference_move (expected + high, expected + low, size);
+              std::memmove (buffer_a + high, buffer_a + low, size);
+              if (!CHECK (same (buffer_a, expected)))
+                {
+                  return;
+                }
+
+              fill_random (buffer_a);
+              reference_move (expected, buffer_a, buffer_size);
+              reference_move (expected + low, expected + high, size);
+              std::memmove (buffer_a + low, buffer_a + high, size);
+              if (!CHECK (same (buffer_a, expected)))
+                {
+                  return;
+                }
+            }
+        }
+    }
+
+    void
+    test_memcmp (void)
+    {
+      for (size_t size = 0; size <= max_size; ++size)
+        {
+          for (size_t alignment = 0; alignment < max_alignment; ++alignment)
+            {
+              fill_random (buffer_a);
+              uint8_t* a = buffer_a + guard + alignment;
+              uint8_t* b = buffer_b + guard + (size % max_alignment);
+              reference_move (b, a, size);
+
+              if (!CHECK (std::memcmp (a, b, size) == 0))
+                {
+                  return;
+                }
+              if (size == 0)
+                {
+                  continue;
+                }
+
+              // A difference at a random position, in both orders,
+              // with the top bit set to check the unsigned comparison.
+              size_t position = random_byte () % size;
+              b[position] ^= 0x80;
+              int reference = reference_compare (a, b, size);
+              if (!CHECK (sign (std::memcmp (a, b, size)) == reference)
+                  || !CHECK (sign (std::memcmp (b, a, size)) == -reference))
+                {
+                  return;
+                }
+            }
+        }
+    }
+
+    void
+    test_strlen (void)
+    {
+      for (size_t length = 0; length <= max_size; ++length)
+        {
+          for (size_t alignment = 0; alignment < max_alignment; ++alignment)
+            {
+              char* s = reinterpret_cast<char*> (buffer_a + guard
+                                                 + alignment);
+              volatile char* v = s;
+              for (size_t i = 0; i < length; ++i)
+                {
+                  v[i] = static_cast<char> ((random_byte () | 1) & 0x7F);
+                }
+              v[length] = '\0';
+
+              if (!CHECK (std::strlen (s) == length))
+                {
+                  return;
+                }
+            }
+        }
+    }
+
+    void
+    test_atomics (void)
+    {
+      volatile uint32_t word32 = 5;
+      CHECK (aarch64_architecture_atomic_fetch_add_32 (&word32, 3) == 5);
+      CHECK (word32 == 8);
+      CHECK (aarch64_architecture_atomic_compare_exchange_32 (&word32, 7, 1)
+             == 8);
+      CHECK (word32 == 8);
+      CHECK (aarch64_architecture_atomic_compare_exchange_32 (&word32, 8, 1)
+             == 8);
+      CHECK (word32 == 1);
+      CHECK (aarch64_architecture_atomic_swap_32 (&word32, 9) == 1);
+      CHECK (word32 == 9);
+
+      volatile uint64_t word64 = 0xFFFFFFFF;
+      CHECK (aarch64_architecture_atomic_fetch_add_64 (&word64, 1)
+             == 0xFFFFFFFF);
+      CHECK (word64 == 0x100000000ULL);
+
+      volatile uint32_t flag = 0;
+      CHECK (!aarch64_architecture_atomic_test_and_set (&flag));
+      CHECK (aarch64_architecture_atomic_test_and_set (&flag));
+      aarch64_architecture_atomic_clear (&flag);
+      CHECK (flag == 0);
+
+      aarch64_architecture_ticket_lock_t ticket{};
+      CHECK (aarch64_architecture_ticket_lock_try_acquire (&ticket));
+      CHECK (!aarch64_architecture_ticket_lock_try_acquire (&ticket));
+      aarch64_architecture_ticket_lock_release (&ticket);
+      CHECK (aarch64_architecture_ticket_lock_try_acquire (&ticket));
+      aarch64_architecture_ticket_lock_release (&ticket);
+
+      aarch64_architecture_mcs_lock_t mcs{};
+      aarch64_architecture_mcs_node_t node;
+      aarch64_architecture_mcs_lock_acquire (&mcs, &node);
+      CHECK (mcs.tail == &node);
+      aarch64_architecture_mcs_lock_release (&mcs, &node);
+      CHECK (mcs.tail == nullptr);
+    }
+
+    void
+    test_streams (void)
+    {
+      static const char path[] = "tests.tmp";
+      static const char text[] = "The quick brown fox\n";
+
+      aarch64::architecture::semihosting::stream<64> stream;
+      if (!CHECK (stream.open (path, AARCH64_SEMIHOSTING_OPEN_WRITE_BINARY)))
+        {
+          return;
+        }
+      // More than the buffer size, to force several flushes.
+      for (int i = 0; i < 10; ++i)
+        {
+          CHECK (stream.puts (text)
+                 == static_cast<ptrdiff_t> (sizeof (text) - 1));
+        }
+      CHECK (stream.close ());
+
+      if (!CHECK (stream.open (path, AARCH64_SEMIHOSTING_OPEN_READ_BINARY)))
+        {
+          return;
+        }
+      CHECK (stream.length ()
+             == 10 * static_cast<ptrdiff_t> (sizeof (text) - 1));
+
+      char line[sizeof (text)];
+      for (int i = 0; i < 10; ++i)
+        {
+          CHECK (stream.read (line, sizeof (text) - 1)
+                 == static_cast<ptrdiff_t> (sizeof (text) - 1));
+          line[sizeof (text) - 1] = '\0';
+          CHECK (std::strcmp (line, text) == 0);
+        }
+      CHECK (stream.getc () == -1);
+
+      CHECK (stream.seek (4));
+      CHECK (stream.getc () == 'q');
+      CHECK (stream.close ());
+
+      micro_os_plus_semihosting_param_block_t block[2]
+          = { reinterpret_cast<micro_os_plus_semihosting_param_block_t> (
+                  path),
+              sizeof (path) - 1 };
+      CHECK (micro_os_plus_semihosting_call_host (
+                 AARCH64_SEMIHOSTING_SYS_REMOVE, block)
+             == 0);
+    }
+
+    void
+    test_stacks (void)
+    {
+      alignas (16) static uint64_t stack[264];
+      constexpr uint64_t magic
+          = MICRO_OS_PLUS_INTEGER_STARTUP_STACK_FILL_MAGIC * 0x100000001ULL;
+      uint8_t* begin = reinterpret_cast<uint8_t*> (stack);
+      uint8_t* end = begin + sizeof (stack);
+
+      // Unaligned to 16 at both ends too.
+      for (size_t offset = 0; offset <= 8; offset += 8)
+        {
+          for (size_t used = 0; used <= 256; used += 8)
+            {
+              aarch64_architecture_stack_fill (begin + offset, end - offset);
+              CHECK (stack[offset / 8] == magic);
+              CHECK (stack[263 - offset / 8] == magic);
+
+              size_t size = sizeof (stack) - 2 * offset;
+              volatile uint8_t* top = end - offset;
+              if (used != 0)
+                {
+                  // Only one byte of the lowest used doubleword.
+                  top[-static_cast<ptrdiff_t> (used)] = 0;
+                }
+              if (!CHECK (aarch64_architecture_stack_get_unused (
+                              begin + offset, end - offset)
+                          == size - used)
+                  || !CHECK (aarch64_architecture_stack_get_high_water (
+                                 begin + offset, end - offset)
+                             == used))
+                {
+                  return;
+                }
+            }
+        }
+
+      // The platform switched the threads to SP_EL0.
+      CHECK (aarch64_architecture_get_spsel () == 0);
+      CHECK (aarch64_architecture_interrupts_stack_get_end (0)
+             > aarch64_architecture_interrupts_stack_get_begin (0));
+    }
+
+    void
+    test_registers (void)
+    {
+      using namespace aarch64::architecture::registers;
+
+      // A local is on the current stack, just below the SP at entry.
+      volatile uint64_t local = 0;
+      uint64_t sp = aarch64_architecture_get_sp ();
+      CHECK (sp % 16 == 0);
+      CHECK (sp <= reinterpret_cast<uintptr_t> (&local));
+      CHECK (reinterpret_cast<uintptr_t> (&local) - sp < 4096);
+      CHECK (micro_os_plus::architecture::registers::sp () == sp);
+
+      CHECK (sysreg<"MPIDR_EL1">::read ()
+             == aarch64_architecture_get_mpidr ());
+      CHECK (sysreg<"CNTFRQ_EL0">::read ()
+             == aarch64_architecture_generic_timer_get_frequency ());
+      CHECK (sysreg<"SPSel">::read () == aarch64_architecture_get_spsel ());
+
+      // A scratch register, several fields in a single write.
+      using tpidr = sysreg<"TPIDR_EL0">;
+      constexpr field<"TPIDR_EL0", 0, 8, uint32_t> low{};
+      constexpr field<"TPIDR_EL0", 60, 4, uint32_t> high{};
+      constexpr field<"TPIDR_EL0", 8, 1, bool> flag{};
+
+      uint64_t saved = tpidr::read ();
+      tpidr::write (0x0123456789ABCDEFULL);
+      tpidr::modify (low (0x5A), high (0xF), flag (false));
+      CHECK (tpidr::read () == 0xF123456789ABCC5AULL);
+      CHECK (tpidr::read (low) == 0x5A);
+      CHECK (tpidr::read (high) == 0xF);
+      CHECK (!tpidr::read (flag));
+      tpidr::set (flag (true));
+      CHECK (tpidr::read () == 0x100);
+      tpidr::write (saved);
+    }
+
+    MICRO_OS_PLUS_ATTRIBUTE_READ_MOSTLY uint32_t read_mostly = 1;
+    MICRO_OS_PLUS_ATTRIBUTE_WRITE_HOT volatile uint32_t write_hot[16] = { 2 };
+
+    __attribute__ ((hot, noinline)) uint32_t
+    hot_function (uint32_t value)
+    {
+      return value * 3;
+    }
+
+    MICRO_OS_PLUS_ATTRIBUTE_FAST_TEXT uint32_t
+    fast_function (uint32_t value)
+    {
+      return value + 5;
+    }
+
+    template <typename T>
+    bool
+    is_between (T* object, const char* begin, const char* end)
+    {
+      uintptr_t p = reinterpret_cast<uintptr_t> (object);
+      return p >= reinterpret_cast<uintptr_t> (begin)
+             && p < reinterpret_cast<uintptr_t> (end);
+    }
+
+    void
+    test_sections (void)
+    {
+      CHECK (is_between (&read_mostly, __data_read_mostly_start__,
+                         __data_read_mostly_end__));
+      CHECK (is_between (&write_hot, __data_write_hot_start__,
+                         __data_write_hot_end__));
+      CHECK (reinterpret_cast<uintptr_t> (&write_hot) % 64 == 0);
+      CHECK (reinterpret_cast<uintptr_t> (__data_write_hot_start__) % 64
+             == 0);
+      CHECK (read_mostly == 1 && write_hot[0] == 2);
+
+      CHECK (is_between (&hot_function, __text_hot_start__,
+                         __text_hot_end__));
+      CHECK (is_between (&fast_function, __fast_text_start__,
+                         __fast_text_end__));
+      CHECK (hot_function (2) == 6 && fast_function (2) == 7);
+    }
+
+    // A static constructor, recorded by the init profiler.
+    struct constructed
+    {
+      constructed ()
+      {
+        value = 42;
+      }
+      volatile uint32_t value;
+    } constructed_object;
+
+    uint32_t lazy_constructions;
+
+    struct deferred
+    {
+      deferred ()
+      {
+        ++lazy_constructions;
+        value = 7;
+      }
+      uint32_t value;
+    };
+
+    aarch64::architecture::startup::lazy<deferred> lazy_object;
+
+    void
+    test_init_profiler (void)
+    {
+      using namespace aarch64::architecture;
+
+      CHECK (constructed_object.value == 42);
+
+      size_t count = init_profiler::count ();
+      const init_profiler::entry* entries = init_profiler::entries ();
+      bool has_init = false;
+      bool has_init_array = false;
+      for (size_t i = 0; i < count; ++i)
+        {
+          has_init = has_init
+                     || entries[i].kind == AARCH64_INIT_PROFILER_KIND_INIT;
+          has_init_array
+              = has_init_array
+                || entries[i].kind == AARCH64_INIT_PROFILER_KIND_INIT_ARRAY;
+          CHECK (i == 0 || entries[i].begin >= entries[i - 1].begin);
+        }
+      CHECK (has_init && has_init_array);
+
+      // Not constructed by the startup, only on first use.
+      CHECK (!lazy_object.is_constructed () && lazy_constructions == 0);
+      CHECK (lazy_object->value == 7);
+      CHECK (lazy_object.get ().value == 7 && lazy_constructions == 1);
+      CHECK (init_profiler::count () == count + 1);
+      CHECK (init_profiler::entries ()[count].kind
+             == AARCH64_INIT_PROFILER_KIND_LAZY);
+    }
+
+    // Two hex digits per byte.
+    size_t
+    from_hex (const char* text, uint8_t* bytes)
+    {
+      size_t size = 0;
+      for (; text[0] != '\0' && text[1] != '\0'; text += 2)
+        {
+          auto digit = [] (char c) {
+            return (c <= '9') ? c - '0' : c - 'a' + 10;
+          };
+          bytes[size++]
+              = static_cast<uint8_t> (digit (text[0]) << 4 | digit (text[1]));
+        }
+      return size;
+    }
+
+    // Bitwise, reflected.
+    uint32_t
+    crc_reference (uint32_t polynomial, const uint8_t* data, size_t size)
+    {
+      uint32_t crc = 0xFFFFFFFF;
+      for (size_t i = 0; i < size; ++i)
+        {
+          crc ^= data[i];
+          for (int bit = 0; bit < 8; ++bit)
+            {
+              crc = (crc >> 1) ^ ((crc & 1) ? polynomial : 0);
+            }
+        }
+      return ~crc;
+    }
+
+    uint8_t crypto_data[2500];
+    uint8_t crypto_output[sizeof (crypto_data)];
+    uint8_t crypto_expected[sizeof (crypto_data)];
+    uint8_t crypto_expected_tag[16];
+    bool crypto_first = true;
+
+    void
+    check_crypto (void)
+    {
+      using namespace aarch64::architecture;
+
+      const char* check = "123456789";
+      CHECK (crypto::crc32 (check, 9) == 0xCBF43926);
+      CHECK (crypto::crc32c (check, 9) == 0xE3069283);
+      CHECK (crypto::crc32 (check + 4, 5, crypto::crc32 (check, 4))
+             == 0xCBF43926);
+
+      // Long enough for the interleaved lanes, at all alignments.
+      for (size_t offset = 0; offset < 8; ++offset)
+        {
+          size_t size = sizeof (crypto_data) - offset - 3;
+          CHECK (crypto::crc32 (crypto_data + offset, size)
+                 == crc_reference (0xEDB88320, crypto_data + offset, size));
+          CHECK (crypto::crc32c (crypto_data + offset, size)
+                 == crc_reference (0x82F63B78, crypto_data + offset, size));
+        }
+
+      // FIPS-197, Appendix C.
+      uint8_t key[32];
+      for (size_t i = 0; i < sizeof (key); ++i)
+        {
+          key[i] = static_cast<uint8_t> (i);
+        }
+      const char* ciphers[] = {
+        "69c4e0d86a7b0430d8cdb78070b4c55a",
+        "dda97ca4864cdfe06eaf70a0ec0d7191",
+        "8ea2b7ca516745bfeafc49904b496089",
+      };
+      uint8_t block[16];
+      uint8_t expected_block[16];
+      for (size_t k = 0; k < 3; ++k)
+        {
+          aarch64_architecture_aes_key_t aes;
+          CHECK (aarch64_architecture_aes_set_key (&aes, key, 16 + 8 * k)
+                 == 0);
+          from_hex ("00112233445566778899aabbccddeeff", block);
+          aarch64_architecture_aes_encrypt_block (&aes, block, block);
+          from_hex (ciphers[k], expected_block);
+          CHECK (std::memcmp (block, expected_block, 16) == 0);
+        }
+      aarch64_architecture_aes_key_t aes;
+      CHECK (aarch64_architecture_aes_set_key (&aes, key, 20) == -1);
+
+      // The GCM specification, Test Case 4: additional crypto_data and
+      // a partial last block.
+      static uint8_t plain[64];
+      static uint8_t cipher[64];
+      static uint8_t output[64];
+      uint8_t iv[12];
+      uint8_t aad[20];
+      uint8_t tag[16];
+      uint8_t expected_tag[16];
+      from_hex ("feffe9928665731c6d6a8f9467308308", key);
+      from_hex ("cafebabefacedbaddecaf888", iv);
+      from_hex ("feedfacedeadbeeffeedfacedeadbeefabaddad2", aad);
+      size_t size = from_hex (
+          "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72"
+          "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b39",
+          plain);
+      from_hex (
+          "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e"
+          "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091",
+          cipher);
+      from_hex ("5bc94fbc3221a5db94fae95ae7121a47", expected_tag);
+
+      crypto::aes_gcm gcm;
+      CHECK (gcm.set_key (key, 16));
+      gcm.encrypt (iv, aad, sizeof (aad), plain, output, size, tag);
+      CHECK (std::memcmp (output, cipher, size) == 0);
+      CHECK (std::memcmp (tag, expected_tag, 16) == 0);
+      CHECK (gcm.decrypt (iv, aad, sizeof (aad), cipher, output, size, tag));
+      CHECK (std::memcmp (output, plain, size) == 0);
+      tag[15] ^= 1;
+      CHECK (!gcm.decrypt (iv, aad, sizeof (aad), cipher, output, size, tag));
+
+      // Test Case 3: four full blocks, no additional data.
+      size = from_hex (
+          "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72"
+          "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b391aafd255",
+          plain);
+      from_hex (
+          "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e"
+          "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091473f5985",
+          cipher);
+      from_hex ("4d5c2af327cd64a62cf35abd2ba6fab4", expected_tag);
+      gcm.encrypt (iv, aad, 0, plain, output, size, tag);
+      CHECK (std::memcmp (output, cipher, size) == 0);
+      CHECK (std::memcmp (tag, expected_tag, 16) == 0);
+      CHECK (gcm.decrypt (iv, aad, 0, cipher, output, size, tag));
+      CHECK (std::memcmp (output, plain, size) == 0);
+
+      // Many blocks, the same on all the implementations.
+      size = sizeof (crypto_data);
+      gcm.encrypt (iv, aad, sizeof (aad), crypto_data, crypto_output, size,
+                   tag);
+      if (crypto_first)
+        {
+          std::memcpy (crypto_expected, crypto_output, size);
+          std::memcpy (crypto_expected_tag, tag, 16);
+          crypto_first = false;
+        }
+      CHECK (std::memcmp (crypto_output, crypto_expected, size) == 0);
+      CHECK (std::memcmp (tag, crypto_expected_tag, 16) == 0);
+
+      // FIPS 180-4 examples, one and two blocks.
+      uint8_t digest[32];
+      uint8_t expected_digest[32];
+      crypto::sha256 ("abc", 3, digest);
+      from_hex ("ba7816bf8f01cfea414140de5dae2223"
+                "b00361a396177a9cb410ff61f20015ad",
+                expected_digest);
+      CHECK (std::memcmp (digest, expected_digest, 32) == 0);
+      crypto::sha256 (
+          "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 56,
+          digest);
+      from_hex ("248d6a61d20638b8e5c026930c3e6039"
+                "a33ce45964ff2167f6ecedd419db06c1",
+                expected_digest);
+      CHECK (std::memcmp (digest, expected_digest, 32) == 0);
+    }
+
+    void
+    test_crypto (void)
+    {
+      using namespace aarch64::architecture;
+
+      for (size_t i = 0; i < sizeof (crypto_data); ++i)
+        {
+          crypto_data[i] = random_byte ();
+        }
+
+      // The instructions, GHASH without PMULL, then all portable.
+      uint32_t features = crypto::features ();
+      static const uint32_t selections[] = {
+        AARCH64_CRYPTO_FEATURE_CRC32 | AARCH64_CRYPTO_FEATURE_AES
+            | AARCH64_CRYPTO_FEATURE_PMULL | AARCH64_CRYPTO_FEATURE_SHA256,
+        AARCH64_CRYPTO_FEATURE_CRC32 | AARCH64_CRYPTO_FEATURE_AES,
+        0,
+      };
+      for (uint32_t selection : selections)
+        {
+          aarch64_architecture_crypto_select_features (selection);
+          check_crypto ();
+        }
+
+      aarch64_architecture_crypto_select_features (features);
+    }
+
+    void
+    test_memory (void)
+    {
+      using namespace aarch64::architecture;
+
+      CHECK (memory::initialize_heap (128 * 1024));
+      size_t line = memory::line_size ();
+      size_t max_size = aarch64_architecture_memory_get_max_block_size ();
+      CHECK (line >= 16);
+      CHECK (max_size >= line);
+
+      void* blocks[4];
+      size_t sizes[] = { 1, line, line + 1, max_size };
+      for (size_t i = 0; i < 4; ++i)
+        {
+          blocks[i] = memory::allocate (sizes[i]);
+          CHECK (blocks[i] != nullptr);
+          CHECK ((reinterpret_cast<uintptr_t> (blocks[i]) & (line - 1)) == 0);
+          std::memset (blocks[i], 0xA5, sizes[i]);
+        }
+      CHECK (memory::allocate (max_size + 1) == nullptr);
+
+      // The last freed block is the first reused.
+      void* block = memory::allocate (line);
+      CHECK (block != blocks[1]);
+      memory::deallocate (block);
+      CHECK (memory::allocate (line) == block);
+      for (size_t i = 0; i < 4; ++i)
+        {
+          memory::deallocate (blocks[i]);
+        }
+      memory::deallocate (nullptr);
+
+      memory::arena arena;
+      CHECK (arena.initialize (4 * line));
+      void* first = arena.allocate (1);
+      CHECK (first != nullptr);
+      CHECK ((reinterpret_cast<uintptr_t> (first) & (line - 1)) == 0);
+      struct point
+      {
+        int x;
+        int y;
+      };
+      point* p = arena.make<point> (1, 2);
+      CHECK (p != nullptr && p->x == 1 && p->y == 2);
+      CHECK (arena.used () == 2 * line);
+      CHECK (arena.allocate (3 * line) == nullptr);
+      arena.reset ();
+      CHECK (arena.used () == 0);
+      CHECK (arena.allocate (4 * line) == first);
+    }
+
+    void
+    test_queues (void)
+    {
+      using namespace aarch64::architecture;
+
+      static spsc_queue<16> spsc;
+      static mpmc_queue<16> mpmc;
+      uint64_t messages[20];
+      uint64_t received[20];
+      for (uint64_t i = 0; i < 20; ++i)
+        {
+          messages[i] = 0x1000 + i;
+        }
+
+      uint64_t message;
+      CHECK (spsc.empty ());
+      CHECK (!spsc.pop (message));
+      CHECK (spsc.push (messages[0]));
+      CHECK (!spsc.empty ());
+      CHECK (spsc.pop (message) && message == messages[0]);
+      // Only the free slots are filled; wraps around the ring.
+      CHECK (spsc.push (messages, 20) == 16);
+      CHECK (!spsc.push (messages[0]));
+      CHECK (spsc.pop (received, 10) == 10);
+      CHECK (spsc.push (messages + 16, 4) == 4);
+      CHECK (spsc.pop (received + 10, 20) == 10);
+      CHECK (std::memcmp (received, messages, sizeof (received)) == 0);
+      CHECK (spsc.empty ());
+
+      CHECK (mpmc.empty ());
+      CHECK (mpmc.push (messages, 20) == 16);
+      CHECK (!mpmc.push (messages[0]));
+      CHECK (mpmc.pop (received, 10) == 10);
+      CHECK (mpmc.push (messages + 16, 4) == 4);
+      CHECK (mpmc.pop (received + 10, 20) == 10);
+      CHECK (std::memcmp (received, messages, sizeof (received)) == 0);
+      CHECK (!mpmc.pop (message));
+
+      aarch64_architecture_spsc_queue_t queue;
+      CHECK (aarch64_architecture_spsc_queue_initialize (&queue, messages, 20)
+             == -1);
+
+      // Rings only when armed, once.
+      aarch64_architecture_doorbell_t event;
+      aarch64_architecture_doorbell_initialize (&event, AARCH64_DOORBELL_EVENT,
+                                                0);
+      CHECK (!aarch64_architecture_doorbell_ring (&event));
+      aarch64_architecture_doorbell_arm (&event);
+      CHECK (aarch64_architecture_doorbell_ring (&event));
+      CHECK (!aarch64_architecture_doorbell_ring (&event));
+
+      // Does not sleep if the queue is not empty, and disarms.
+      doorbell bell{ AARCH64_DOORBELL_EVENT, 0 };
+      spsc.push (messages[0]);
+      bell.wait ([] { return !spsc.empty (); });
+      CHECK (!bell.ring ());
+      CHECK (spsc.pop (message) && spsc.empty ());
+    }
+
+    // Shared by the two cores in test_smp().
+    struct smp_test_s
+    {
+      aarch64::architecture::spsc_queue<16> requests;
+      aarch64::architecture::spsc_queue<16> replies;
+      aarch64::architecture::doorbell to_secondary{ AARCH64_DOORBELL_EVENT,
+                                                    0 };
+      aarch64::architecture::doorbell to_primary{ AARCH64_DOORBELL_EVENT,
+                                                  0 };
+      aarch64::architecture::mpmc_queue<16> shared;
+      aarch64::architecture::ticket_lock ticket;
+      aarch64::architecture::mcs_lock mcs;
+      uint64_t ticket_counter;
+      uint64_t mcs_counter;
+      uint64_t shared_sum;
+      volatile uint32_t done;
+    };
+
+    constexpr uint32_t smp_messages = 1000;
+    constexpr uint32_t smp_iterations = 10000;
+
+    // Run by both cores at the same time.
+    void
+    smp_contend (smp_test_s& t, uint64_t core)
+    {
+      uint64_t sum = 0;
+      for (uint32_t i = 0; i < smp_iterations; ++i)
+        {
+          t.ticket.lock ();
+          ++t.ticket_counter;
+          t.ticket.unlock ();
+
+          {
+            aarch64::architecture::mcs_lock::guard guard{ t.mcs };
+            ++t.mcs_counter;
+          }
+
+          // Each core pushes one message then pops one, which may be
+          // from the other core; the queue never has more than two.
+          while (!t.shared.push ((core << 32) | i))
+            {
+            }
+          uint64_t message;
+          while (!t.shared.pop (message))
+            {
+            }
+          sum += message;
+        }
+
+      t.ticket.lock ();
+      t.shared_sum += sum;
+      t.ticket.unlock ();
+    }
+
+    void
+    smp_secondary (void* arg)
+    {
+      smp_test_s& t = *static_cast<smp_test_s*> (arg);
+
+      // Echo the requests, incremented.
+      for (uint32_t i = 0; i < smp_messages; ++i)
+        {
+          uint64_t message;
+          t.to_secondary.wait ([&t] { return !t.requests.empty (); });
+          t.requests.pop (message);
+          while (!t.replies.push (message + 1))
+            {
+            }
+          t.to_primary.ring ();
+        }
+
+      smp_contend (t, 1);
+
+      aarch64_architecture_store_release_32 (&t.done, 1);
+    }
+
+    void
+    test_smp (void)
+    {
+      using namespace aarch64::architecture;
+
+      static smp_test_s t;
+      int32_t result = smp::start_core (1, smp_secondary, &t);
+      if (result == AARCH64_PSCI_INVALID_PARAMETERS)
+        {
+          return; // A single core; QEMU runs without `-smp 2`.
+        }
+      CHECK (result == AARCH64_PSCI_SUCCESS);
+      if (result != AARCH64_PSCI_SUCCESS)
+        {
+          return;
+        }
+
+      // Request/reply through the single producer queues, with the
+      // doorbells, one message at a time.
+      uint32_t errors = 0;
+      for (uint32_t i = 0; i < smp_messages; ++i)
+        {
+          while (!t.requests.push (0x1000 + i))
+            {
+            }
+          t.to_secondary.ring ();
+
+          uint64_t reply;
+          t.to_primary.wait ([] { return !t.replies.empty (); });
+          t.replies.pop (reply);
+          errors += (reply != 0x1000 + i + 1);
+        }
+      CHECK (errors == 0);
+
+      smp_contend (t, 0);
+
+      uint64_t deadline
+          = aarch64_architecture_generic_timer_get_counter ()
+            + 5 * aarch64_architecture_generic_timer_get_frequency ();
+      while (aarch64_architecture_load_acquire_32 (&t.done) == 0
+             && aarch64_architecture_generic_timer_get_counter () < deadline)
+        {
+        }
+      CHECK (t.done != 0);
+
+      // Lost updates would show as lower counts.
+      CHECK (t.ticket_counter == 2 * smp_iterations);
+      CHECK (t.mcs_counter == 2 * smp_iterations);
+
+      // Sum of i over the iterations, once per core, plus 1 << 32
+      // for each message of core 1.
+      uint64_t expected = uint64_t{ smp_iterations } * (smp_iterations - 1)
+                          + (uint64_t{ smp_iterations } << 32);
+      CHECK (t.shared_sum == expected);
+    }
+
+    // System call handlers, in the table at the end of the file.
+    int64_t
+    sys_add (int64_t a, int64_t b)
+    {
+      return a + b;
+    }
+
+    size_t
+    sys_length (const char* string)
+    {
+      return std::strlen (string);
+    }
+
+    void
+    sys_null (void)
+    {
+    }
+
+    void
+    test_syscalls (void)
+    {
+      using namespace aarch64::architecture;
+
+      // The number in the immediate and in x8.
+      CHECK (syscalls::call<1> (2, -5) == -3);
+      CHECK (syscalls::call (2, "hello") == 5);
+      CHECK (aarch64_architecture_syscall (1, 40, 2, 0, 0, 0, 0) == 42);
+      CHECK (micro_os_plus::architecture::syscall (1, 1, 1) == 2);
+      CHECK (syscalls::call<3> () == 0);
+
+      CHECK (syscalls::call<10> () == AARCH64_SYSCALL_NOT_IMPLEMENTED);
+      CHECK (syscalls::call (syscalls::count)
+             == AARCH64_SYSCALL_NOT_IMPLEMENTED);
+      CHECK (syscalls::call (0xFFFFFFFF) == AARCH64_SYSCALL_NOT_IMPLEMENTED);
+    }
+
+    void
+    test_trace (void)
+    {
+      using namespace aarch64::architecture;
+
+      constexpr size_t records = MICRO_OS_PLUS_INTEGER_TRACE_RECORDS;
+
+      if (trace::initialize ())
+        {
+          // Left by a previous run, without a power-on reset.
+          trace::start ();
+        }
+      uint64_t sequence = trace::sequence ();
+      uint32_t core = aarch64_architecture_get_core_id ();
+      CHECK (trace::count (core) == 0);
+
+      // The oldest 3 are overwritten.
+      for (uint64_t i = 0; i < records + 3; ++i)
+        {
+          trace::event (7, i, ~i);
+        }
+      CHECK (trace::count (core) == records);
+      const trace::record* first = trace::get (core, 0);
+      const trace::record* last = trace::get (core, records - 1);
+      CHECK (first != nullptr && first->core == core && first->event == 7
+             && first->arg0 == 3 && first->arg1 == ~uint64_t{ 3 });
+      CHECK (last != nullptr && last->arg0 == records + 2
+             && last->timestamp >= first->timestamp);
+      CHECK (trace::get (core, records) == nullptr);
+
+      trace::stop ();
+      trace::event (8);
+      CHECK (trace::get (core, records - 1)->event == 7);
+
+      static const char path[] = "trace.tmp";
+      CHECK (trace::write (path));
+      semihosting::stream<64> stream;
+      if (CHECK (stream.open (path, AARCH64_SEMIHOSTING_OPEN_READ_BINARY)))
+        {
+          aarch64_architecture_trace_file_t header{};
+          CHECK (stream.read (&header, sizeof (header))
+                 == static_cast<ptrdiff_t> (sizeof (header)));
+          CHECK (header.magic == AARCH64_TRACE_MAGIC
+                 && header.sequence == sequence && header.recovered == 0);
+          CHECK (stream.length ()
+                 == static_cast<ptrdiff_t> (
+                     sizeof (header)
+                     + header.cores
+                           * sizeof (aarch64_architecture_trace_file_ring_t)
+                     + records * sizeof (trace::record)));
+          CHECK (stream.close ());
+        }
+
+      // As after a warm reset: the rings are kept and not extended.
+      trace::flush ();
+      CHECK (trace::initialize ());
+      CHECK (trace::is_recovered () && trace::sequence () == sequence);
+      trace::event (8);
+      CHECK (trace::count (core) == records);
+      CHECK (trace::get (core, records - 1)->arg0 == records + 2);
+
+      trace::start ();
+      CHECK (!trace::is_recovered () && trace::sequence () == sequence + 1);
+      CHECK (trace::count (core) == 0);
+    }
+
+    void
+    test_clock (void)
+    {
+      using namespace aarch64::architecture;
+      using micro_os_plus::architecture::monotonic_clock;
+
+      // Common counter frequencies, and a few odd ones; the result is
+      // the exact value, or 1 ns less.
+      static const uint32_t frequencies[] = {
+        1000000, 19200000, 24000000, 25000000, 62500000, 100000000,
+        1000000000, 32768, 3, 4000000000u,
+      };
+      static const uint64_t values[] = {
+        0, 1, 7, 1000, 123456789, 1ull << 40, 0x0123456789ABCDEFull,
+      };
+      for (uint32_t frequency : frequencies)
+        {
+          aarch64_architecture_clock_t c{};
+          aarch64_architecture_clock_calibrate (&c, frequency);
+          for (uint64_t ticks : values)
+            {
+              unsigned __int128 exact
+                  = static_cast<unsigned __int128> (ticks) * 1000000000u
+                    / frequency;
+              if (exact >> 64 != 0)
+                {
+                  continue;
+                }
+              uint64_t ns = aarch64_architecture_clock_scale (
+                  ticks, c.ns_per_tick, c.ns_per_tick_fraction);
+              CHECK (ns == exact || ns + 1 == exact);
+
+              uint64_t back = aarch64_architecture_clock_scale (
+                  ticks, c.ticks_per_ns, c.ticks_per_ns_fraction);
+              exact = static_cast<unsigned __int128> (ticks) * frequency
+                      / 1000000000u;
+              CHECK (back == exact || back + 1 == exact);
+            }
+        }
+
+      CHECK (aarch64_architecture_clock.frequency
+             == aarch64_architecture_generic_timer_get_frequency ());
+      uint64_t second = clock::ns_to_ticks (1000000000u);
+      CHECK (second + 1 >= aarch64_architecture_clock.frequency
+             && second <= aarch64_architecture_clock.frequency);
+
+      auto begin = monotonic_clock::now ();
+      auto ns = static_cast<monotonic_clock::rep> (clock::ns ());
+      auto end = monotonic_clock::now ();
+      CHECK (begin.time_since_epoch ().count () > 0);
+      CHECK (begin.time_since_epoch ().count () <= ns
+             && ns <= end.time_since_epoch ().count ());
+      CHECK (end - begin >= std::chrono::nanoseconds{ 0 });
+    }
+
+    // Small integers, so the float sums are exact in any order.
+    constexpr size_t dsp_size = 1600;
+    float dsp_a[dsp_size];
+    float dsp_b[dsp_size];
+    float dsp_out[dsp_size];
+    int8_t dsp_s8[dsp_size];
+    aarch64_architecture_float16_t dsp_f16[dsp_size];
+
+    void
+    check_dsp (void)
+    {
+      using namespace aarch64::architecture;
+
+      // Around the ASIMD and the SVE (from 128 to 2048 bits) sizes,
+      // of the 32-bit, 16-bit and 8-bit elements, with partial tails.
+      static const size_t counts[]
+          = { 0,  1,  3,  4,   5,   15,  16,  17,  31,
+              63, 64, 65, 127, 129, 255, 256, 257, 513 };
+      static const size_t taps[] = { 1, 3, 4, 5, 16 };
+      constexpr size_t rows = 3;
+
+      for (size_t count : counts)
+        {
+          float dot = 0;
+          for (size_t i = 0; i < count; ++i)
+            {
+              dot += dsp_a[i] * dsp_b[i];
+            }
+          CHECK (dsp::dot (dsp_a, dsp_b, count) == dot);
+
+          for (size_t n : taps)
+            {
+              dsp_out[count] = -1000;
+              dsp::fir (dsp_b, n, dsp_a, dsp_out, count);
+              bool same = dsp_out[count] == -1000;
+              for (size_t i = 0; i < count; ++i)
+                {
+                  float sum = 0;
+                  for (size_t k = 0; k < n; ++k)
+                    {
+                      sum += dsp_b[k] * dsp_a[i + k];
+                    }
+                  same = same && dsp_out[i] == sum;
+                }
+              CHECK (same);
+            }
+
+          if (rows * count + 7 <= dsp_size)
+            {
+              int32_t y[rows + 1] = { 0, 0, 0, -1 };
+              float yf[rows + 1] = { 0, 0, 0, -1 };
+              dsp::gemv (dsp_s8, dsp_s8 + 7, y, rows, count);
+              dsp::gemv (dsp_f16, dsp_f16 + 7, yf, rows, count);
+              bool same = y[rows] == -1 && yf[rows] == -1;
+              for (size_t r = 0; r < rows; ++r)
+                {
+                  int32_t sum = 0;
+                  float sumf = 0;
+                  for (size_t c = 0; c < count; ++c)
+                    {
+                      sum += dsp_s8[r * count + c] * dsp_s8[7 + c];
+                      sumf += static_cast<float> (dsp_f16[r * count + c])
+                              * static_cast<float> (dsp_f16[7 + c]);
+                    }
+                  same = same && y[r] == sum && yf[r] == sumf;
+                }
+              CHECK (same);
+            }
+
+          float low = 0;
+          float high = 0;
+          if (count == 0)
+            {
+              CHECK (!dsp::min_max (dsp_a, count, low, high));
+              continue;
+            }
+          float min = dsp_a[1];
+          float max = dsp_a[1];
+          for (size_t i = 1; i <= count; ++i)
+            {
+              min = dsp_a[i] < min ? dsp_a[i] : min;
+              max = dsp_a[i] > max ? dsp_a[i] : max;
+            }
+          CHECK (dsp::min_max (dsp_a + 1, count, low, high) && low == min
+                 && high == max);
+
+          // The NaNs are ignored, also the first one.
+          float first = dsp_a[0];
+          dsp_a[0] = std::numeric_limits<float>::quiet_NaN ();
+          CHECK (dsp::min_max (dsp_a, count + 1, low, high) && low == min
+                 && high == max);
+          dsp_a[0] = first;
+        }
+    }
+
+    void
+    test_dsp (void)
+    {
+      using namespace aarch64::architecture;
+
+      for (size_t i = 0; i < dsp_size; ++i)
+        {
+          dsp_a[i] = static_cast<float> (static_cast<int> (i * 37 % 17) - 8);
+          dsp_b[i] = static_cast<float> (static_cast<int> (i * 53 % 13) - 6);
+          dsp_s8[i] = static_cast<int8_t> (i * 73 + 5);
+          dsp_f16[i] = static_cast<aarch64_architecture_float16_t> (dsp_a[i]);
+        }
+
+      uint32_t features = dsp::features ();
+      CHECK (features & AARCH64_DSP_FEATURE_ASIMD);
+
+      // All the implementations, with all the vector lengths.
+      static const uint32_t selections[] = {
+        AARCH64_DSP_FEATURE_ASIMD | AARCH64_DSP_FEATURE_SVE,
+        AARCH64_DSP_FEATURE_ASIMD,
+        0,
+      };
+      for (uint32_t selection : selections)
+        {
+          aarch64_architecture_dsp_select_features (selection);
+          size_t length = 16;
+          for (size_t bytes = 16; bytes <= 256; bytes *= 2)
+            {
+              size_t set = aarch64_architecture_dsp_set_vector_length (bytes);
+              if (bytes > 16
+                  && (set <= length
+                      || !(dsp::features () & AARCH64_DSP_FEATURE_SVE)))
+                {
+                  break;
+                }
+              length = set;
+              CHECK (dsp::vector_length () == length
+                     || !(dsp::features () & AARCH64_DSP_FEATURE_SVE));
+              check_dsp ();
+            }
+        }
+
+      aarch64_architecture_dsp_select_features (features);
+      aarch64_architecture_dsp_set_vector_length (256);
+    }
+
+    volatile uint32_t sgi_count;
+    void* volatile sgi_arg;
+
+    void
+    sgi_handler (void* arg, aarch64_architecture_exception_frame_t* frame)
+    {
+      (void)frame;
+      sgi_arg = arg;
+      sgi_count = sgi_count + 1;
+    }
+
+    void
+    test_gic (void)
+    {
+      constexpr uint32_t intid = 1;
+      static int cookie;
+
+      aarch64_architecture_gic_set_handler (intid, sgi_handler, &cookie);
+      aarch64_architecture_gic_enable (intid);
+
+      aarch64_architecture_gic_send_sgi (intid,
+                                         aarch64_architecture_get_mpidr ());
+      uint64_t deadline
+          = aarch64_architecture_generic_timer_get_counter ()
+            + aarch64_architecture_generic_timer_get_frequency () / 100;
+      while (sgi_count == 0
+             && aarch64_architecture_generic_timer_get_counter () < deadline)
+        {
+        }
+      CHECK (sgi_count == 1);
+      CHECK (sgi_arg == &cookie);
+
+      // Masked by the priority mask, then taken when unmasked.
+      aarch64_architecture_gic_set_priority_mask (0);
+      aarch64_architecture_gic_send_sgi (intid,
+                                         aarch64_architecture_get_mpidr ());
+      for (int i = 0; i < 1000; ++i)
+        {
+          aarch64_architecture_isb ();
+        }
+      CHECK (sgi_count == 1);
+      aarch64_architecture_gic_set_priority_mask (0xFF);
+      aarch64_architecture_isb ();
+      deadline = aarch64_architecture_generic_timer_get_counter ()
+                 + aarch64_architecture_generic_timer_get_frequency () / 100;
+      while (sgi_count == 1
+             && aarch64_architecture_generic_timer_get_counter () < deadline)
+        {
+        }
+      CHECK (sgi_count == 2);
+
+      aarch64_architecture_gic_disable (intid);
+
+      // The handlers ran on the interrupts stack.
+      size_t used = aarch64_architecture_interrupts_stack_get_high_water (0);
+      CHECK (used >= sizeof (aarch64_architecture_exception_frame_t));
+      CHECK (used < 4096);
+    }
+  } // namespace
+
+  // --------------------------------------------------------------------------
+
+  void
+  run_tests (void)
+  {
+    test_memcpy_memset ();
+    test_memmove ();
+    test_memcmp ();
+    test_strlen ();
+    test_atomics ();
+    test_streams ();
+    test_stacks ();
+    test_registers ();
+    test_sections ();
+    test_init_profiler ();
+    test_crypto ();
+    test_memory ();
+    test_queues ();
+    test_smp ();
+    test_syscalls ();
+    test_trace ();
+    test_clock ();
+    test_dsp ();
+    test_gic ();
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::architecture::tests
+
+// ----------------------------------------------------------------------------
+
+extern "C" const aarch64_architecture_syscalls_table_t
+    aarch64_architecture_syscalls_table
+    = aarch64::architecture::syscalls::make_table ({
+        { 1, aarch64::architecture::syscalls::handler<
+                 micro_os_plus::architecture::tests::sys_add> },
+        { 2, aarch64::architecture::syscalls::handler<
+                 micro_os_plus::architecture::tests::sys_length> },
+        { 3, aarch64::architecture::syscalls::handler<
+                 micro_os_plus::architecture::tests::sys_null> },
+    });
+
+// ----------------------------------------------------------------------------